@@ -0,0 +1,110 @@
+/***************************************************************************************************
+ * @file: 			DEBOUNCE_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes for the inputs debouncing driver
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef DEBOUNCE_INTERFACE_H
+#define DEBOUNCE_INTERFACE_H
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the DEBOUNCE funcs*/
+typedef enum
+{
+	DEBOUNCE_Exit_OK,
+	DEBOUNCE_NULL_Ptr_Err,
+	DEBOUNCE_InvalidPort
+
+}DEBOUNCE_ErrorStates_t;
+
+
+
+										/******************		Interfacing Structs		****************/
+/*
+ * A port debounced as a whole: all the pins in PinsMask are sampled by one IDR read per tick and
+ * debounced in parallel by 2-bit vertical counters, a pin changes state after 4 equal samples.
+ */
+typedef struct
+{
+	Port_t Port;						/*The GPIO port to sample*/
+	uint16_t PinsMask;					/*The pins to debounce, bit n for pin n*/
+	uint16_t ActiveLowMask;				/*The pins that are active(pressed) when low, e.g. buttons to GND*/
+
+	/*Private, handled by the driver*/
+	uint16_t State;						/*Debounced state, 1 = active*/
+	uint16_t Count0;					/*Vertical counter bit 0*/
+	uint16_t Count1;					/*Vertical counter bit 1*/
+	uint16_t Pressed;					/*Accumulated inactive->active edges*/
+	uint16_t Released;					/*Accumulated active->inactive edges*/
+
+}DEBOUNCE_Port_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to init a debounced port, the current pins levels are
+ * 								taken as the initial state so no edges are reported at startup
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct with its configs filled
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The pins are configed as INPUT using the GPIO driver
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The port is ready to be ticked
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_Init(DEBOUNCE_Port_t *Copy_pPort);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to sample the port and advance the debouncing of all its pins,
+ * 								constant time regardless of the number of pins
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 								-  Called periodically, e.g. every 5ms from a timer tick
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The debounced state & edges are updated
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_Tick(DEBOUNCE_Port_t *Copy_pPort);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get & clear the edges accumulated since the last call
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 								- uint16_t* Copy_pu16Pressed: ptr to recive the pins that became active
+ * 								- uint16_t* Copy_pu16Released: ptr to recive the pins that became inactive
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The edges are retrieved and cleared, safe against DEBOUNCE_Tick() from a timer ISR
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_GetEdges(DEBOUNCE_Port_t *Copy_pPort, uint16_t* Copy_pu16Pressed, uint16_t* Copy_pu16Released);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the debounced state of the pins
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 								- uint16_t* Copy_pu16State: ptr to recive the state, 1 = active
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The state is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_GetState(DEBOUNCE_Port_t *Copy_pPort, uint16_t* Copy_pu16State);
+
+
+
+#endif
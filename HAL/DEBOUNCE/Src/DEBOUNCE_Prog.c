@@ -0,0 +1,183 @@
+/***************************************************************************************************
+ * @file: 			DEBOUNCE_Prog.c
+ * @brief: 			This file contains the implementation for the inputs debouncing driver
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include "stdint.h"
+
+#include "GPIO_Interface.h"
+
+#include "DEBOUNCE_Interface.h"
+
+
+/*
+ *
+ * @brief: Pressed & Released are set by DEBOUNCE_Tick() (a timer ISR) and taken by DEBOUNCE_GetEdges() (the main loop),
+ * 			both sides use single atomic accesses (LDREXH/STREXH on the Cortex-M4) so no edge is lost between them
+ *
+ * */
+_Static_assert(__atomic_always_lock_free(sizeof(uint16_t), 0), "the edges masks need lock free atomics");
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to init a debounced port, the current pins levels are
+ * 								taken as the initial state so no edges are reported at startup
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct with its configs filled
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The pins are configed as INPUT using the GPIO driver
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The port is ready to be ticked
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_Init(DEBOUNCE_Port_t *Copy_pPort)
+{
+	DEBOUNCE_ErrorStates_t Local_u8ErrorState = DEBOUNCE_Exit_OK;
+	uint16_t Local_u16Sample;
+
+	if(Copy_pPort != NULL)
+	{
+		if(GPIO_u8ReadBus(Copy_pPort -> Port, Copy_pPort -> PinsMask, &Local_u16Sample) == GPIO_Exit_OK)
+		{
+			Copy_pPort -> State    = Local_u16Sample ^ (Copy_pPort -> ActiveLowMask & Copy_pPort -> PinsMask);
+			Copy_pPort -> Count0   = 0;
+			Copy_pPort -> Count1   = 0;
+			Copy_pPort -> Pressed  = 0;
+			Copy_pPort -> Released = 0;
+		}
+
+		else
+		{
+			Local_u8ErrorState = DEBOUNCE_InvalidPort;
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = DEBOUNCE_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to sample the port and advance the debouncing of all its pins,
+ * 								constant time regardless of the number of pins
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 								-  Called periodically, e.g. every 5ms from a timer tick
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The debounced state & edges are updated
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_Tick(DEBOUNCE_Port_t *Copy_pPort)
+{
+	DEBOUNCE_ErrorStates_t Local_u8ErrorState = DEBOUNCE_Exit_OK;
+	uint16_t Local_u16Sample;
+	uint16_t Local_u16Delta;
+	uint16_t Local_u16Toggle;
+
+	if(Copy_pPort != NULL)
+	{
+		if(GPIO_u8ReadBus(Copy_pPort -> Port, Copy_pPort -> PinsMask, &Local_u16Sample) == GPIO_Exit_OK)
+		{
+			/*1 = active for every pin*/
+			Local_u16Sample ^= (Copy_pPort -> ActiveLowMask & Copy_pPort -> PinsMask);
+
+			/*Pins whose sample differs from the debounced state count up, the others are reset to 0*/
+			Local_u16Delta = Local_u16Sample ^ (Copy_pPort -> State);
+
+			Copy_pPort -> Count1 = ((Copy_pPort -> Count1) ^ (Copy_pPort -> Count0)) & Local_u16Delta;
+			Copy_pPort -> Count0 = ~(Copy_pPort -> Count0) & Local_u16Delta;
+
+			/*A counter rolling over 3 -> 0 while still different means 4 equal samples: the pin changes state*/
+			Local_u16Toggle = Local_u16Delta & ~((Copy_pPort -> Count0) | (Copy_pPort -> Count1));
+
+			Copy_pPort -> State    ^= Local_u16Toggle;
+			__atomic_fetch_or(&(Copy_pPort -> Pressed), (uint16_t)(Local_u16Toggle & (Copy_pPort -> State)), __ATOMIC_RELAXED);
+			__atomic_fetch_or(&(Copy_pPort -> Released), (uint16_t)(Local_u16Toggle & ~(Copy_pPort -> State)), __ATOMIC_RELAXED);
+		}
+
+		else
+		{
+			Local_u8ErrorState = DEBOUNCE_InvalidPort;
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = DEBOUNCE_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get & clear the edges accumulated since the last call
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 								- uint16_t* Copy_pu16Pressed: ptr to recive the pins that became active
+ * 								- uint16_t* Copy_pu16Released: ptr to recive the pins that became inactive
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The edges are retrieved and cleared, safe against DEBOUNCE_Tick() from a timer ISR
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_GetEdges(DEBOUNCE_Port_t *Copy_pPort, uint16_t* Copy_pu16Pressed, uint16_t* Copy_pu16Released)
+{
+	DEBOUNCE_ErrorStates_t Local_u8ErrorState = DEBOUNCE_Exit_OK;
+
+	if((Copy_pPort != NULL) && (Copy_pu16Pressed != NULL) && (Copy_pu16Released != NULL))
+	{
+		/*Read & cleared in one atomic access: an edge latched by the tick meanwhile is kept for the next call*/
+		*Copy_pu16Pressed  = __atomic_exchange_n(&(Copy_pPort -> Pressed), (uint16_t)0, __ATOMIC_RELAXED);
+		*Copy_pu16Released = __atomic_exchange_n(&(Copy_pPort -> Released), (uint16_t)0, __ATOMIC_RELAXED);
+	}
+
+	else
+	{
+		Local_u8ErrorState = DEBOUNCE_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the debounced state of the pins
+ * 	Parameters:                 - DEBOUNCE_Port_t *Copy_pPort: The address of the port struct
+ * 								- uint16_t* Copy_pu16State: ptr to recive the state, 1 = active
+ * 	Returns:                    - DEBOUNCE_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DEBOUNCE_Init() must be used to init the port first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The state is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DEBOUNCE_ErrorStates_t DEBOUNCE_GetState(DEBOUNCE_Port_t *Copy_pPort, uint16_t* Copy_pu16State)
+{
+	DEBOUNCE_ErrorStates_t Local_u8ErrorState = DEBOUNCE_Exit_OK;
+
+	if((Copy_pPort != NULL) && (Copy_pu16State != NULL))
+	{
+		*Copy_pu16State = Copy_pPort -> State;
+	}
+
+	else
+	{
+		Local_u8ErrorState = DEBOUNCE_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ * @file: 			EXTI_BIND_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes of the EXTI pins binding: arming a pin
+ * 					interrupt (RCC clks, GPIO, SYSCFG, EXTI & NVIC) in one call, the line & IRQ are derived from the pin
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef EXTI_BIND_INTERFACE_H
+#define EXTI_BIND_INTERFACE_H
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the binding funcs*/
+typedef enum
+{
+	EXTI_BIND_Exit_OK,
+	EXTI_BIND_NULL_Ptr_Err,
+	EXTI_BIND_InvalidPort,
+	EXTI_BIND_InvalidPin,
+	EXTI_BIND_InvalidEdge,
+	EXTI_BIND_InvalidPriority,
+	EXTI_BIND_InvalidCount,
+	EXTI_BIND_LineConflict,				/*Two pins of the same number: they share the EXTI line*/
+	EXTI_BIND_PriorityConflict,			/*Two pins sharing an IRQ (EXTI9_5, EXTI15_10) with different priorities*/
+	EXTI_BIND_PinSetupErr,				/*The GPIO call failed*/
+	EXTI_BIND_RoutingErr,				/*The SYSCFG call failed*/
+	EXTI_BIND_LineSetupErr,				/*An EXTI call failed*/
+	EXTI_BIND_IRQSetupErr				/*An NVIC call failed*/
+
+}EXTI_BIND_ErrorStates_t;
+
+
+
+										/******************		Interfacing Structs		****************/
+/*A pin binding configs*/
+typedef struct
+{
+	Port_t Port;
+	Pin_t Pin;
+	PullUpDown_t PullType;
+	EXTI_TrigEdge_t Edge;
+	uint8_t Priority;						/*NVIC priority 0 (highest) ~ 15, shared by the pins of the same IRQ*/
+	void (*Func)(void *Copy_pContext);		/*The line callback*/
+	void *Context;							/*Passed back to Func*/
+
+}EXTI_BIND_Config_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to arm a pin interrupt: the port & SYSCFG clks are enabled,
+ * 								the pin set as input (no pull), routed to its line, the line edge & callback set,
+ * 								then the line & its IRQ are enabled with the given priority
+ * 	Parameters:                 - Port_t Copy_u8Port: the pin port
+ * 								- Pin_t Copy_u8Pin: the pin number, the EXTI line is the same number
+ * 								- EXTI_TrigEdge_t Copy_u8Edge: the trigger edge
+ * 								- uint8_t Copy_u8Priority: the NVIC priority of the line IRQ 0 ~ 15
+ * 								- void (*Copy_pFunc)(void *): the line callback
+ * 								- void *Copy_pContext: passed back to the callback
+ * 	Returns:                    - EXTI_BIND_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               The pin configs and the IRQ priority are overwritten, the line mode is kept: it is set
+ * 								by EXTI_SetLineMode() before the binding (EXTI_MODE_CALLBACK by default)
+ * 	Post Conditions:            The pin edges run the callback
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_BIND_ErrorStates_t EXTI_BindPin(Port_t Copy_u8Port, Pin_t Copy_u8Pin, EXTI_TrigEdge_t Copy_u8Edge, uint8_t Copy_u8Priority,
+										void (*Copy_pFunc)(void *Copy_pContext), void *Copy_pContext);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to arm several pins interrupts at once, the registers writes
+ * 								are merged: each GPIO port, EXTICR, RTSR, FTSR & IMR register is written once and each
+ * 								IRQ is set once
+ * 	Parameters:                 - const EXTI_BIND_Config_t *Copy_pConfigs: array of the pins configs
+ * 								- uint8_t Copy_u8Count: the number of pins 1 ~ 16
+ * 	Returns:                    - EXTI_BIND_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               All the configs are validated first, a bad entry leaves the hardware untouched. A failed
+ * 								driver call stops the binding at that step: no line or IRQ is enabled after it.
+ * 								The lines modes are kept, set them before the binding (EXTI_MODE_CALLBACK by default)
+ * 	Post Conditions:            The pins edges run their callbacks
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_BIND_ErrorStates_t EXTI_BindPins(const EXTI_BIND_Config_t *Copy_pConfigs, uint8_t Copy_u8Count);
+
+
+
+#endif
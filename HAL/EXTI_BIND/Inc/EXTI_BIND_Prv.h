@@ -0,0 +1,18 @@
+/***************************************************************************************************
+ * @file: 			EXTI_BIND_Prv.h
+ * @brief: 			This file contains the private definitions of the EXTI pins binding
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef EXTI_BIND_PRV_H
+#define EXTI_BIND_PRV_H
+
+
+#define EXTI_BIND_PORTS_NUM			8u			/*PORTA ~ PORTH*/
+#define EXTI_BIND_PINS_NUM			16u			/*Pins 0~15 are the EXTI lines 0~15*/
+#define EXTI_BIND_MAX_PRIORITY		15u
+
+
+
+#endif
@@ -0,0 +1,303 @@
+/***************************************************************************************************
+ * @file: 			EXTI_BIND_Prog.c
+ * @brief: 			This file contains the implementation of the EXTI pins binding
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include "stdint.h"
+
+#include "RCC_Interface.h"
+#include "GPIO_Interface.h"
+#include "SYSCFG_Interface.h"
+#include "EXTI_Interface.h"
+#include "NVIC_Interface.h"
+
+#include "EXTI_BIND_Interface.h"
+#include "EXTI_BIND_Prv.h"
+
+
+/*
+ *
+ * @brief: The clk, the SYSCFG code of each port and the IRQ of each pin line
+ *
+ * */
+static const AHB1_Peripheral_t EXTI_BIND_PortsClks[EXTI_BIND_PORTS_NUM] =
+{
+	AHB1_GPIOA, AHB1_GPIOB, AHB1_GPIOC, AHB1_GPIOD, AHB1_GPIOE, AHB1_GPIOF, AHB1_GPIOG, AHB1_GPIOH
+};
+
+
+static const SYSCFG_IntPort_t EXTI_BIND_PortsCodes[EXTI_BIND_PORTS_NUM] =
+{
+	SYSCFG_PORTA, SYSCFG_PORTB, SYSCFG_PORTC, SYSCFG_PORTD, SYSCFG_PORTE, SYSCFG_PORTF, SYSCFG_PORTG, SYSCFG_PORTH
+};
+
+
+static const NVIC_IRQs_t EXTI_BIND_PinsIRQs[EXTI_BIND_PINS_NUM] =
+{
+	IRQ6_EXTI0, IRQ7_EXTI1, IRQ8_EXTI2, IRQ9_EXTI3, IRQ10_EXTI4,
+	IRQ23_EXTI9_5, IRQ23_EXTI9_5, IRQ23_EXTI9_5, IRQ23_EXTI9_5, IRQ23_EXTI9_5,
+	IRQ40_EXTI15_10, IRQ40_EXTI15_10, IRQ40_EXTI15_10, IRQ40_EXTI15_10, IRQ40_EXTI15_10, IRQ40_EXTI15_10
+};
+
+
+
+/*
+ *
+ * @brief: Validating a binding against its own ranges and the previous bindings of the batch
+ *
+ * */
+static EXTI_BIND_ErrorStates_t EXTI_BIND_u8CheckConfig(const EXTI_BIND_Config_t *Copy_pConfigs, uint8_t Copy_u8Index)
+{
+	EXTI_BIND_ErrorStates_t Local_u8ErrorState = EXTI_BIND_Exit_OK;
+	const EXTI_BIND_Config_t * Local_pConfig = &Copy_pConfigs[Copy_u8Index];
+	uint8_t Local_u8Counter;
+
+	if(Local_pConfig -> Func == NULL)
+	{
+		Local_u8ErrorState = EXTI_BIND_NULL_Ptr_Err;
+	}
+
+	else if(Local_pConfig -> Port >= EXTI_BIND_PORTS_NUM)
+	{
+		Local_u8ErrorState = EXTI_BIND_InvalidPort;
+	}
+
+	else if(Local_pConfig -> Pin >= EXTI_BIND_PINS_NUM)
+	{
+		Local_u8ErrorState = EXTI_BIND_InvalidPin;
+	}
+
+	else if((Local_pConfig -> Edge != EXTI_RisingEdge) && (Local_pConfig -> Edge != EXTI_FallingEdge) && (Local_pConfig -> Edge != EXTI_OnChange))
+	{
+		Local_u8ErrorState = EXTI_BIND_InvalidEdge;
+	}
+
+	else if(Local_pConfig -> Priority > EXTI_BIND_MAX_PRIORITY)
+	{
+		Local_u8ErrorState = EXTI_BIND_InvalidPriority;
+	}
+
+	else
+	{
+		for(Local_u8Counter = 0; Local_u8Counter < Copy_u8Index; Local_u8Counter++)
+		{
+			if(Copy_pConfigs[Local_u8Counter].Pin == Local_pConfig -> Pin)
+			{
+				Local_u8ErrorState = EXTI_BIND_LineConflict;
+				break;
+			}
+
+			else if((EXTI_BIND_PinsIRQs[Copy_pConfigs[Local_u8Counter].Pin] == EXTI_BIND_PinsIRQs[Local_pConfig -> Pin]) &&
+					(Copy_pConfigs[Local_u8Counter].Priority != Local_pConfig -> Priority))
+			{
+				Local_u8ErrorState = EXTI_BIND_PriorityConflict;
+				break;
+			}
+		}
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to arm a pin interrupt: the port & SYSCFG clks are enabled,
+ * 								the pin set as input (no pull), routed to its line, the line edge & callback set,
+ * 								then the line & its IRQ are enabled with the given priority
+ * 	Parameters:                 - Port_t Copy_u8Port: the pin port
+ * 								- Pin_t Copy_u8Pin: the pin number, the EXTI line is the same number
+ * 								- EXTI_TrigEdge_t Copy_u8Edge: the trigger edge
+ * 								- uint8_t Copy_u8Priority: the NVIC priority of the line IRQ 0 ~ 15
+ * 								- void (*Copy_pFunc)(void *): the line callback
+ * 								- void *Copy_pContext: passed back to the callback
+ * 	Returns:                    - EXTI_BIND_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               The pin configs and the IRQ priority are overwritten, the line mode is kept: it is set
+ * 								by EXTI_SetLineMode() before the binding (EXTI_MODE_CALLBACK by default)
+ * 	Post Conditions:            The pin edges run the callback
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_BIND_ErrorStates_t EXTI_BindPin(Port_t Copy_u8Port, Pin_t Copy_u8Pin, EXTI_TrigEdge_t Copy_u8Edge, uint8_t Copy_u8Priority,
+										void (*Copy_pFunc)(void *Copy_pContext), void *Copy_pContext)
+{
+	EXTI_BIND_Config_t Local_Config =
+	{
+		.Port = Copy_u8Port,
+		.Pin = Copy_u8Pin,
+		.PullType = NO_PULL,
+		.Edge = Copy_u8Edge,
+		.Priority = Copy_u8Priority,
+		.Func = Copy_pFunc,
+		.Context = Copy_pContext
+	};
+
+	return EXTI_BindPins(&Local_Config, 1u);
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to arm several pins interrupts at once, the registers writes
+ * 								are merged: each GPIO port, EXTICR, RTSR, FTSR & IMR register is written once and each
+ * 								IRQ is set once
+ * 	Parameters:                 - const EXTI_BIND_Config_t *Copy_pConfigs: array of the pins configs
+ * 								- uint8_t Copy_u8Count: the number of pins 1 ~ 16
+ * 	Returns:                    - EXTI_BIND_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               All the configs are validated first, a bad entry leaves the hardware untouched. A failed
+ * 								driver call stops the binding at that step: no line or IRQ is enabled after it.
+ * 								The lines modes are kept, set them before the binding (EXTI_MODE_CALLBACK by default)
+ * 	Post Conditions:            The pins edges run their callbacks
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_BIND_ErrorStates_t EXTI_BindPins(const EXTI_BIND_Config_t *Copy_pConfigs, uint8_t Copy_u8Count)
+{
+	EXTI_BIND_ErrorStates_t Local_u8ErrorState = EXTI_BIND_Exit_OK;
+	PinConfig_t Local_Pins[EXTI_BIND_PINS_NUM] = {0};
+	SYSCFG_IntPort_t Local_Ports[EXTI_BIND_PINS_NUM] = {0};
+	uint32_t Local_u32Lines = 0;
+	uint32_t Local_u32Rising = 0;
+	uint32_t Local_u32Falling = 0;
+	uint64_t Local_u64IRQs = 0;
+	uint8_t Local_u8UsedPorts = 0;
+	uint8_t Local_u8Counter;
+
+	if(Copy_pConfigs == NULL)
+	{
+		Local_u8ErrorState = EXTI_BIND_NULL_Ptr_Err;
+	}
+
+	else if((Copy_u8Count == 0u) || (Copy_u8Count > EXTI_BIND_PINS_NUM))
+	{
+		Local_u8ErrorState = EXTI_BIND_InvalidCount;
+	}
+
+	else
+	{
+		/*Validating all the configs first so a bad entry leaves the hardware untouched*/
+		for(Local_u8Counter = 0; Local_u8Counter < Copy_u8Count; Local_u8Counter++)
+		{
+			Local_u8ErrorState = EXTI_BIND_u8CheckConfig(Copy_pConfigs, Local_u8Counter);
+
+			if(Local_u8ErrorState != EXTI_BIND_Exit_OK)
+			{
+				break;
+			}
+		}
+	}
+
+
+	if((Copy_pConfigs != NULL) && (Local_u8ErrorState == EXTI_BIND_Exit_OK))
+	{
+		/*Deriving the pins, EXTICR, edges & IRQs images from the tables*/
+		for(Local_u8Counter = 0; Local_u8Counter < Copy_u8Count; Local_u8Counter++)
+		{
+			const EXTI_BIND_Config_t * Local_pConfig = &Copy_pConfigs[Local_u8Counter];
+			uint32_t Local_u32Line = (1UL << Local_pConfig -> Pin);
+
+			Local_Pins[Local_u8Counter].Port = Local_pConfig -> Port;
+			Local_Pins[Local_u8Counter].PinNum = Local_pConfig -> Pin;
+			Local_Pins[Local_u8Counter].Mode = INPUT;
+			Local_Pins[Local_u8Counter].PullType = Local_pConfig -> PullType;
+
+			Local_Ports[Local_pConfig -> Pin] = EXTI_BIND_PortsCodes[Local_pConfig -> Port];
+			Local_u8UsedPorts |= (1u << Local_pConfig -> Port);
+			Local_u32Lines |= Local_u32Line;
+
+			if(Local_pConfig -> Edge != EXTI_FallingEdge)
+			{
+				Local_u32Rising |= Local_u32Line;
+			}
+
+			if(Local_pConfig -> Edge != EXTI_RisingEdge)
+			{
+				Local_u32Falling |= Local_u32Line;
+			}
+		}
+
+
+		/*Clks first, then the pins are routed before their lines are armed*/
+		for(Local_u8Counter = 0; Local_u8Counter < EXTI_BIND_PORTS_NUM; Local_u8Counter++)
+		{
+			if((Local_u8UsedPorts >> Local_u8Counter) & 1u)
+			{
+				RCC_AHB1EnableClk(EXTI_BIND_PortsClks[Local_u8Counter]);
+			}
+		}
+
+		RCC_APB2EnableClk(APB2_SYSCFG);
+
+		/*Each step runs only if the previous ones passed, so a failure never leaves a line or an IRQ enabled*/
+		if(GPIO_u8PortInit(Local_Pins, Copy_u8Count) != GPIO_Exit_OK)
+		{
+			Local_u8ErrorState = EXTI_BIND_PinSetupErr;
+		}
+
+		else if(SYSCFG_SetEXTIPorts((uint16_t)Local_u32Lines, Local_Ports) != SYSCFG_Exit_Ok)
+		{
+			Local_u8ErrorState = EXTI_BIND_RoutingErr;
+		}
+
+		else
+		{
+			/*The callbacks are in place before any line can fire*/
+			for(Local_u8Counter = 0; (Local_u8Counter < Copy_u8Count) && (Local_u8ErrorState == EXTI_BIND_Exit_OK); Local_u8Counter++)
+			{
+				EXTI_ExtIntLine_t Local_u8Line = (EXTI_ExtIntLine_t)Copy_pConfigs[Local_u8Counter].Pin;
+
+				if(EXTI_SetCallBackCtxFunc(Local_u8Line, Copy_pConfigs[Local_u8Counter].Func, Copy_pConfigs[Local_u8Counter].Context) != EXTI_Exit_OK)
+				{
+					Local_u8ErrorState = EXTI_BIND_LineSetupErr;
+				}
+			}
+		}
+
+		/*Edges set & the stale pending flags cleared, then the IRQs priorities before anything is enabled*/
+		if((Local_u8ErrorState == EXTI_BIND_Exit_OK) && (EXTI_SetTrigEdgeLines(Local_u32Lines, Local_u32Rising, Local_u32Falling) != EXTI_Exit_OK))
+		{
+			Local_u8ErrorState = EXTI_BIND_LineSetupErr;
+		}
+
+		for(Local_u8Counter = 0; (Local_u8Counter < Copy_u8Count) && (Local_u8ErrorState == EXTI_BIND_Exit_OK); Local_u8Counter++)
+		{
+			NVIC_IRQs_t Local_u8IRQ = EXTI_BIND_PinsIRQs[Copy_pConfigs[Local_u8Counter].Pin];
+
+			if(((Local_u64IRQs >> Local_u8IRQ) & 1u) == 0u)
+			{
+				Local_u64IRQs |= (1ULL << Local_u8IRQ);
+
+				if(NVIC_SetPriority(Local_u8IRQ, Copy_pConfigs[Local_u8Counter].Priority) != NVIVC_Exit_Ok)
+				{
+					Local_u8ErrorState = EXTI_BIND_IRQSetupErr;
+				}
+			}
+		}
+
+		if((Local_u8ErrorState == EXTI_BIND_Exit_OK) && (EXTI_EnableInterruptLines(Local_u32Lines) != EXTI_Exit_OK))
+		{
+			Local_u8ErrorState = EXTI_BIND_LineSetupErr;
+		}
+
+		for(Local_u8Counter = 0; (Local_u8Counter < EXTI_BIND_PINS_NUM) && (Local_u8ErrorState == EXTI_BIND_Exit_OK); Local_u8Counter++)
+		{
+			NVIC_IRQs_t Local_u8IRQ = EXTI_BIND_PinsIRQs[Local_u8Counter];
+
+			if((Local_u64IRQs >> Local_u8IRQ) & 1u)
+			{
+				Local_u64IRQs &= ~(1ULL << Local_u8IRQ);
+
+				if(NVIC_EnableIRQ(Local_u8IRQ) != NVIVC_Exit_Ok)
+				{
+					Local_u8ErrorState = EXTI_BIND_IRQSetupErr;
+				}
+			}
+		}
+	}
+
+	return Local_u8ErrorState;
+}
@@ -0,0 +1,110 @@
+/***************************************************************************************************
+ * @file: 			SWIRQ_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes of the software IRQs: EXTI lines with
+ * 					a dedicated IRQ reserved as prioritized channels to hand work from an ISR (or the main loop)
+ * 					to another priority level, raised through SWIER
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef SWIRQ_INTERFACE_H
+#define SWIRQ_INTERFACE_H
+
+/*
+ * Usable lines, each has its own IRQ so its own priority:
+ * 		- EXTI0 ~ EXTI4: their pins must not be used as EXTI sources
+ * 		- EXTI16_PVD, EXTI17_RTC_ALARM, EXTI18_OTG_FS_WKUP, EXTI20_OTG_HS_WKUP, EXTI21_TAMP_STAMP, EXTI22_RTC_WKUP:
+ * 		  their peripheral events must not be enabled (the best choice when these peripherals are unused)
+ * The EXTI9_5 & EXTI15_10 lines share their IRQ and are rejected.
+ */
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the SWIRQ funcs*/
+typedef enum
+{
+	SWIRQ_Exit_OK,
+	SWIRQ_NULL_Ptr_Err,
+	SWIRQ_InvalidLine,
+	SWIRQ_InvalidPriority,
+	SWIRQ_NotInitialized,
+	SWIRQ_LineSetupErr,						/*An EXTI call failed*/
+	SWIRQ_IRQSetupErr						/*An NVIC call failed*/
+
+}SWIRQ_ErrorStates_t;
+
+
+
+										/******************		Interfacing Structs		****************/
+/*A software IRQ channel configs*/
+typedef struct
+{
+	EXTI_ExtIntLine_t Line;					/*EXTI line with a dedicated IRQ*/
+	uint8_t Priority;						/*NVIC priority 0 (highest) ~ 15*/
+	void (*Func)(void *Copy_pContext);		/*Deferred work, runs at Priority*/
+	void *Context;							/*Passed back to Func*/
+
+}SWIRQ_Config_t;
+
+
+/*Trigger to handler entry latency of a channel, in DWT cycles*/
+typedef struct
+{
+	uint32_t Last;
+	uint32_t Min;
+	uint32_t Max;
+	uint32_t Count;							/*Handled triggers*/
+
+}SWIRQ_Latency_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to reserve an EXTI line as a software IRQ channel: the line
+ * 								interrupt, its callback, its NVIC priority and its IRQ are set
+ * 	Parameters:                 - const SWIRQ_Config_t *Copy_pConfig: the channel configs
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC clk enabled for SYSCFG, DWT_Init() called for the latency measurement
+ * 	Side effects:               The line callback & mode (EXTI_MODE_CALLBACK) are overwritten, its RTSR & FTSR bits
+ * 								are cleared
+ * 	Post Conditions:            The channel is ready to be triggered, on an error it is left uninitialized
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_Init(const SWIRQ_Config_t *Copy_pConfig);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to trigger a channel, its Func runs once the NVIC lets its priority in:
+ * 								at once from a lower priority context, after the current ISR from a higher one
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8Line: the channel line
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  SWIRQ_Init() is called for the line
+ * 	Side effects:               Triggers before the handler entry are merged into one run
+ * 	Post Conditions:            The channel IRQ is pending
+ * 	Synch/Asynch:               Asynch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_Trigger(EXTI_ExtIntLine_t Copy_u8Line);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the trigger to Func entry latency of a channel
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8Line: the channel line
+ * 								- SWIRQ_Latency_t *Copy_pLatency: ptr to receive the latency stats in DWT cycles
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  SWIRQ_Init() is called for the line
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_GetLatency(EXTI_ExtIntLine_t Copy_u8Line, SWIRQ_Latency_t *Copy_pLatency);
+
+
+
+#endif
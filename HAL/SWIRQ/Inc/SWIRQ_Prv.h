@@ -0,0 +1,31 @@
+/***************************************************************************************************
+ * @file: 			SWIRQ_Prv.h
+ * @brief: 			This file contains the private definitions of the software IRQs
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef SWIRQ_PRV_H
+#define SWIRQ_PRV_H
+
+#define NULL ((void *)0)
+
+
+#define SWIRQ_LINES_NUM			23u			/*EXTI lines 0~22*/
+#define SWIRQ_NO_IRQ			0xFFu		/*Line with a shared IRQ or reserved*/
+#define SWIRQ_MAX_PRIORITY		15u
+
+
+/*A channel state*/
+typedef struct
+{
+	void (*Func)(void *Copy_pContext);
+	void *Context;
+	volatile uint32_t TriggerStamp;			/*DWT cycles at the last trigger*/
+	SWIRQ_Latency_t Latency;
+
+}SWIRQ_Channel_t;
+
+
+
+#endif
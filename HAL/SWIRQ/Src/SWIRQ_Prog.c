@@ -0,0 +1,209 @@
+/***************************************************************************************************
+ * @file: 			SWIRQ_Prog.c
+ * @brief: 			This file contains the implementation of the software IRQs
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include "stdint.h"
+
+#include "NVIC_Interface.h"
+#include "EXTI_Interface.h"
+#include "DWT_Interface.h"
+
+#include "SWIRQ_Interface.h"
+#include "SWIRQ_Prv.h"
+
+
+/*
+ *
+ * @brief: The IRQ of each EXTI line, the lines sharing their IRQ can't be channels
+ *
+ * */
+static const uint8_t SWIRQ_LinesIRQs[SWIRQ_LINES_NUM] =
+{
+	IRQ6_EXTI0, IRQ7_EXTI1, IRQ8_EXTI2, IRQ9_EXTI3, IRQ10_EXTI4,
+	SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ,
+	SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ, SWIRQ_NO_IRQ,
+	IRQ1_PVD, IRQ41_RTC_Alarm, IRQ42_OTG_FS_WKUP,
+	SWIRQ_NO_IRQ,
+	IRQ76_OTG_HS_WKUP, IRQ2_TAMP_STAMP, IRQ3_RTC_WKUP
+};
+
+
+static SWIRQ_Channel_t SWIRQ_Channels[SWIRQ_LINES_NUM];
+
+
+
+/*
+ *
+ * @brief: The EXTI callback of all the channels: the latency is taken at entry then the channel work runs
+ *
+ * */
+static void SWIRQ_vidHandler(void *Copy_pContext)
+{
+	SWIRQ_Channel_t * Local_pChannel = (SWIRQ_Channel_t *)Copy_pContext;
+	uint32_t Local_u32Latency = DWT_u32GetCycles() - (Local_pChannel -> TriggerStamp);
+
+	Local_pChannel -> Latency.Last = Local_u32Latency;
+
+	if((Local_pChannel -> Latency.Count == 0u) || (Local_u32Latency < Local_pChannel -> Latency.Min))
+	{
+		Local_pChannel -> Latency.Min = Local_u32Latency;
+	}
+
+	if(Local_u32Latency > Local_pChannel -> Latency.Max)
+	{
+		Local_pChannel -> Latency.Max = Local_u32Latency;
+	}
+
+	Local_pChannel -> Latency.Count++;
+
+	Local_pChannel -> Func(Local_pChannel -> Context);
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to reserve an EXTI line as a software IRQ channel: the line
+ * 								interrupt, its callback, its NVIC priority and its IRQ are set
+ * 	Parameters:                 - const SWIRQ_Config_t *Copy_pConfig: the channel configs
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC clk enabled for SYSCFG, DWT_Init() called for the latency measurement
+ * 	Side effects:               The line callback & mode (EXTI_MODE_CALLBACK) are overwritten, its RTSR & FTSR bits
+ * 								are cleared
+ * 	Post Conditions:            The channel is ready to be triggered, on an error it is left uninitialized
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_Init(const SWIRQ_Config_t *Copy_pConfig)
+{
+	SWIRQ_ErrorStates_t Local_u8ErrorState = SWIRQ_Exit_OK;
+
+	if((Copy_pConfig == NULL) || (Copy_pConfig -> Func == NULL))
+	{
+		Local_u8ErrorState = SWIRQ_NULL_Ptr_Err;
+	}
+
+	else if((Copy_pConfig -> Line >= SWIRQ_LINES_NUM) || (SWIRQ_LinesIRQs[Copy_pConfig -> Line] == SWIRQ_NO_IRQ))
+	{
+		Local_u8ErrorState = SWIRQ_InvalidLine;
+	}
+
+	else if(Copy_pConfig -> Priority > SWIRQ_MAX_PRIORITY)
+	{
+		Local_u8ErrorState = SWIRQ_InvalidPriority;
+	}
+
+	else
+	{
+		SWIRQ_Channel_t * Local_pChannel = &SWIRQ_Channels[Copy_pConfig -> Line];
+		NVIC_IRQs_t Local_u8IRQ = (NVIC_IRQs_t)SWIRQ_LinesIRQs[Copy_pConfig -> Line];
+		uint32_t Local_u32LineMask = (uint32_t)1u << (Copy_pConfig -> Line);
+
+		Local_pChannel -> Func = Copy_pConfig -> Func;
+		Local_pChannel -> Context = Copy_pConfig -> Context;
+		Local_pChannel -> Latency.Last = 0;
+		Local_pChannel -> Latency.Min = 0;
+		Local_pChannel -> Latency.Max = 0;
+		Local_pChannel -> Latency.Count = 0;
+
+		/*No trigger edge: only SWIER raises the line, a pin or peripheral edge never does*/
+		/*Each step runs only if the previous ones passed, the line is unmasked last*/
+		if((EXTI_SetTrigEdgeLines(Local_u32LineMask, 0u, 0u) != EXTI_Exit_OK)
+		|| (EXTI_SetCallBackCtxFunc(Copy_pConfig -> Line, SWIRQ_vidHandler, Local_pChannel) != EXTI_Exit_OK)
+		|| (EXTI_SetLineMode(Copy_pConfig -> Line, EXTI_MODE_CALLBACK) != EXTI_Exit_OK))
+		{
+			Local_u8ErrorState = SWIRQ_LineSetupErr;
+		}
+
+		else if((NVIC_SetPriority(Local_u8IRQ, Copy_pConfig -> Priority) != NVIVC_Exit_Ok)
+		|| (NVIC_EnableIRQ(Local_u8IRQ) != NVIVC_Exit_Ok))
+		{
+			Local_u8ErrorState = SWIRQ_IRQSetupErr;
+		}
+
+		else if(EXTI_EnableInterrupt(Copy_pConfig -> Line) != EXTI_Exit_OK)
+		{
+			Local_u8ErrorState = SWIRQ_LineSetupErr;
+		}
+
+		if(Local_u8ErrorState != SWIRQ_Exit_OK)
+		{
+			/*SWIRQ_Trigger() rejects the channel*/
+			Local_pChannel -> Func = NULL;
+		}
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to trigger a channel, its Func runs once the NVIC lets its priority in
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8Line: the channel line
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  SWIRQ_Init() is called for the line
+ * 	Side effects:               Triggers before the handler entry are merged into one run
+ * 	Post Conditions:            The channel IRQ is pending
+ * 	Synch/Asynch:               Asynch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_Trigger(EXTI_ExtIntLine_t Copy_u8Line)
+{
+	SWIRQ_ErrorStates_t Local_u8ErrorState = SWIRQ_Exit_OK;
+
+	if((Copy_u8Line >= SWIRQ_LINES_NUM) || (SWIRQ_LinesIRQs[Copy_u8Line] == SWIRQ_NO_IRQ))
+	{
+		Local_u8ErrorState = SWIRQ_InvalidLine;
+	}
+
+	else if(SWIRQ_Channels[Copy_u8Line].Func == NULL)
+	{
+		Local_u8ErrorState = SWIRQ_NotInitialized;
+	}
+
+	else
+	{
+		SWIRQ_Channels[Copy_u8Line].TriggerStamp = DWT_u32GetCycles();
+		EXTI_TriggerSoftware(Copy_u8Line);
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the trigger to Func entry latency of a channel
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8Line: the channel line
+ * 								- SWIRQ_Latency_t *Copy_pLatency: ptr to receive the latency stats in DWT cycles
+ * 	Returns:                    - SWIRQ_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  SWIRQ_Init() is called for the line
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+SWIRQ_ErrorStates_t SWIRQ_GetLatency(EXTI_ExtIntLine_t Copy_u8Line, SWIRQ_Latency_t *Copy_pLatency)
+{
+	SWIRQ_ErrorStates_t Local_u8ErrorState = SWIRQ_Exit_OK;
+
+	if(Copy_pLatency == NULL)
+	{
+		Local_u8ErrorState = SWIRQ_NULL_Ptr_Err;
+	}
+
+	else if((Copy_u8Line >= SWIRQ_LINES_NUM) || (SWIRQ_LinesIRQs[Copy_u8Line] == SWIRQ_NO_IRQ))
+	{
+		Local_u8ErrorState = SWIRQ_InvalidLine;
+	}
+
+	else
+	{
+		*Copy_pLatency = SWIRQ_Channels[Copy_u8Line].Latency;
+	}
+
+	return Local_u8ErrorState;
+}
@@ -0,0 +1,176 @@
+/***************************************************************************************************
+ * @file: 			HOSTSIM_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes of the host registers simulation,
+ * 					used to run & benchmark the MCAL drivers on a Linux (x86-64) host without a board
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef HOSTSIM_INTERFACE_H
+#define HOSTSIM_INTERFACE_H
+
+/*
+ * The peripherals regions are mapped on the host at their real addresses (the bases in Stm32F446xx.h are kept as is):
+ * 		- 0x40000000 ~ 0x400FFFFF:	APB/AHB1 peripherals (GPIO, RCC, SYSCFG, EXTI)
+ * 		- 0x42000000 ~ 0x43FFFFFF:	their bit-band alias region
+ * 		- 0xE000E000 ~ 0xE000EFFF:	System Control Space (NVIC, SCB, CoreDebug)
+ * 		- 0xE0001000 ~ 0xE0001FFF:	DWT, CYCCNT only moves with HOSTSIM_AdvanceCycles so the timings are deterministic
+ * Every access to these regions is trapped and single stepped, so the registers side effects are modeled:
+ * 		- RCC:		ready flags in CR follow their ON bits, CFGR.SWS follows CFGR.SW
+ * 		- GPIO:		BSRR sets/resets ODR, IDR is driven by HOSTSIM_SetPinLevel, LCKR key sequence & locked pins
+ * 		- EXTI:		PR is write-1-to-clear, SWIER & pins edges set PR and pend the NVIC IRQ of the line
+ * 		- NVIC:		ISER/ICER & ISPR/ICPR set/clear semantics, STIR
+ * 		- SCB:		AIRCR is only written with the VECTKEY
+ * 		- BASEPRI:	the core BASEPRI (CortexM4_Core.h) masks the IRQs at or below its priority in HOSTSIM_RunPendingIRQs
+ * 		- IPSR:		holds the exception number of the handler run by HOSTSIM_RunPendingIRQs
+ * 		- bit-band:	alias words read/write their bit through the same side effects
+ * More registers can be modeled with HOSTSIM_SetHooks.
+ * Build the drivers with -DMCAL_HOST_SIM and link HOSTSIM_Prog.c, single threaded use only.
+ */
+
+
+									/******************		Interfacing Enums		****************/
+typedef enum
+{
+	HOSTSIM_Exit_OK,
+	HOSTSIM_MapFailed,
+	HOSTSIM_InvalidAddress,
+	HOSTSIM_InvalidIRQ,
+	HOSTSIM_NULL_Ptr_Err
+
+}HOSTSIM_ErrorStates_t;
+
+
+/*Write hook: gets the register address, its value before the write and the written value,
+ * returns the value the register holds after the write*/
+typedef uint32_t (*HOSTSIM_WriteHook_t)(uintptr_t Copy_uptrAddress, uint32_t Copy_u32OldValue, uint32_t Copy_u32Written);
+
+/*Read hook: gets the register address and its stored value, returns the value to be read*/
+typedef uint32_t (*HOSTSIM_ReadHook_t)(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Value);
+
+
+/*Bus accesses statistics*/
+typedef struct
+{
+	uint32_t Reads;
+	uint32_t Writes;
+
+}HOSTSIM_BusStats_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to map the simulated registers and install the traps
+ * 	Returns:                    - HOSTSIM_ErrorStates_t: HOSTSIM_MapFailed if the regions are not free on the host
+ * 	Preconditions:              -  Called once before any driver func
+ * 	Post Conditions:            The registers hold their reset values
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_Init(void);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to put back all the registers to their reset values,
+ * 								the IRQ handlers, hooks and statistics are cleared
+ *************************************************************************************************************/
+void HOSTSIM_Reset(void);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to model the side effects of a register not modeled by the sim
+ * 	Parameters:                 - uintptr_t Copy_uptrAddress: the register address
+ * 								- HOSTSIM_WriteHook_t Copy_pWriteHook: called on each write, NULL for a plain store
+ * 								- HOSTSIM_ReadHook_t Copy_pReadHook: called on each read, NULL for a plain load
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_SetHooks(uintptr_t Copy_uptrAddress, HOSTSIM_WriteHook_t Copy_pWriteHook, HOSTSIM_ReadHook_t Copy_pReadHook);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to read/write a register directly, bypassing the side effects
+ *************************************************************************************************************/
+uint32_t HOSTSIM_Peek(uintptr_t Copy_uptrAddress);
+void HOSTSIM_Poke(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Value);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to drive a GPIO input pin: IDR is updated and an edge is
+ * 								raised on the EXTI line if SYSCFG routes this port to it and RTSR/FTSR select it
+ * 	Parameters:                 - uint8_t Copy_u8Port: 0 for PORTA ~ 7 for PORTH
+ * 								- uint8_t Copy_u8Pin: 0 ~ 15
+ * 								- uint8_t Copy_u8Level: 0 or 1
+ *************************************************************************************************************/
+void HOSTSIM_SetPinLevel(uint8_t Copy_u8Port, uint8_t Copy_u8Pin, uint8_t Copy_u8Level);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to raise an edge on an EXTI line (e.g. the internal lines 16~22)
+ *************************************************************************************************************/
+void HOSTSIM_RaiseEXTILine(uint8_t Copy_u8Line);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to attach an IRQ handler, e.g. EXTI15_10_IRQHandler to IRQ 40
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_SetIRQHandler(uint8_t Copy_u8IRQNum, void (*Copy_pHandler)(void));
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to run the handlers of the enabled & pending IRQs, highest
+ * 								priority first, as the core would do from thread mode
+ * 	Returns:                    - uint32_t: the number of handlers run
+ *************************************************************************************************************/
+uint32_t HOSTSIM_RunPendingIRQs(void);
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get & clear the bus accesses done to the simulated registers
+ * 	Parameters:                 - Copy_pStats: ptr to receive the reads & writes counts since the last call
+ * 	Returns:                    - HOSTSIM_ErrorStates_t: an enum indicating the error state of the function
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_GetBusStats(HOSTSIM_BusStats_t *Copy_pStats);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to advance the DWT cycle counter (if enabled by CTRL.CYCCNTENA)
+ * 	Parameters:                 - Copy_u32Cycles: cycles elapsed, CYCCNT wraps like on the target
+ *************************************************************************************************************/
+void HOSTSIM_AdvanceCycles(uint32_t Copy_u32Cycles);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the func run by the core WFE/WFI (CortexM4_Core.h),
+ * 								e.g. to raise an edge or advance the cycles while the driver sleeps
+ * 	Parameters:                 - Copy_pWaitHook: the hook, NULL to make WFE/WFI return at once
+ *************************************************************************************************************/
+void HOSTSIM_SetWaitHook(void (*Copy_pWaitHook)(void));
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is what CORE_WFE()/CORE_WFI() run under MCAL_HOST_SIM
+ *************************************************************************************************************/
+void HOSTSIM_WaitForEvent(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 These Functions are what the CORE_*BASEPRI* accesses (CortexM4_Core.h) run under MCAL_HOST_SIM
+ * 	Parameters:                 - Copy_u32BasePri: the priority byte as written to the core (e.g. 5 << 4), 0 masks nothing
+ *************************************************************************************************************/
+uint32_t HOSTSIM_GetBasePri(void);
+void HOSTSIM_SetBasePri(uint32_t Copy_u32BasePri);
+void HOSTSIM_SetBasePriMax(uint32_t Copy_u32BasePri);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is what CORE_GET_IPSR() (CortexM4_Core.h) runs under MCAL_HOST_SIM
+ * 	Returns:                    - uint32_t: 16 + the IRQ of the handler being run, 0 out of the handlers
+ *************************************************************************************************************/
+uint32_t HOSTSIM_GetIPSR(void);
+
+
+
+#endif
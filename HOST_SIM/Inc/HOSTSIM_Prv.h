@@ -0,0 +1,117 @@
+/***************************************************************************************************
+ * @file: 			HOSTSIM_Prv.h
+ * @brief: 			This file contains the private definitions of the host registers simulation
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef HOSTSIM_PRV_H
+#define HOSTSIM_PRV_H
+
+
+/******************* Simulated Regions *******************/
+#define HOSTSIM_PERIPH_SIZE			0x00100000UL		/*Peripherals bit-band region, 1MB*/
+#define HOSTSIM_ALIAS_SIZE			0x02000000UL		/*Its alias region, 32MB*/
+#define HOSTSIM_SCS_BASE			0xE000E000UL		/*System Control Space: NVIC, SCB*/
+#define HOSTSIM_SCS_SIZE			0x00001000UL
+#define HOSTSIM_DWT_SIZE			0x00001000UL		/*DWT, CYCCNT advanced by HOSTSIM_AdvanceCycles*/
+
+#define HOSTSIM_MAX_PENDING			4u					/*Max regions pages touched by a single instruction*/
+#define HOSTSIM_MAX_HOOKS			32u
+#define HOSTSIM_MAX_IRQ_RUNS		1024u				/*Bounds RunPendingIRQs when a handler never clears its flag*/
+
+#define HOSTSIM_X86_TRAP_FLAG		0x100UL				/*EFLAGS.TF: single step*/
+#define HOSTSIM_X86_PF_WRITE		0x2UL				/*Page fault error code: write access*/
+
+
+/******************* Registers Addresses & Offsets *******************/
+#define HOSTSIM_GPIO_PORTS_NUM		8u
+#define HOSTSIM_GPIO_PORT_SIZE		0x400UL
+
+#define HOSTSIM_GPIO_MODER			0x00UL
+#define HOSTSIM_GPIO_OTYPER			0x04UL
+#define HOSTSIM_GPIO_OSPEEDR		0x08UL
+#define HOSTSIM_GPIO_PUPDR			0x0CUL
+#define HOSTSIM_GPIO_IDR			0x10UL
+#define HOSTSIM_GPIO_ODR			0x14UL
+#define HOSTSIM_GPIO_BSRR			0x18UL
+#define HOSTSIM_GPIO_LCKR			0x1CUL
+#define HOSTSIM_GPIO_AFRL			0x20UL
+#define HOSTSIM_GPIO_AFRH			0x24UL
+#define HOSTSIM_GPIO_LCKK			16u
+
+#define HOSTSIM_RCC_CR				(RCC_BASE_ADDRESS + 0x00UL)
+#define HOSTSIM_RCC_CFGR			(RCC_BASE_ADDRESS + 0x08UL)
+#define HOSTSIM_RCC_CR_ON_BITS		0x15010001UL		/*HSION, HSEON, PLLON, PLLI2SON, PLLSAION*/
+#define HOSTSIM_RCC_CR_RDY_BITS		0x2A020002UL		/*Their RDY flags, one bit above each*/
+#define HOSTSIM_RCC_CFGR_SW			0x3UL
+#define HOSTSIM_RCC_CFGR_SWS		0xCUL
+
+#define HOSTSIM_SYSCFG_EXTICR		(SYSCFG_BASE_ADDRESS + 0x08UL)
+
+#define HOSTSIM_EXTI_IMR			(EXTI_BASE_ADDRESS + 0x00UL)
+#define HOSTSIM_EXTI_EMR			(EXTI_BASE_ADDRESS + 0x04UL)
+#define HOSTSIM_EXTI_RTSR			(EXTI_BASE_ADDRESS + 0x08UL)
+#define HOSTSIM_EXTI_FTSR			(EXTI_BASE_ADDRESS + 0x0CUL)
+#define HOSTSIM_EXTI_SWIER			(EXTI_BASE_ADDRESS + 0x10UL)
+#define HOSTSIM_EXTI_PR				(EXTI_BASE_ADDRESS + 0x14UL)
+#define HOSTSIM_EXTI_LINES_NUM		23u
+
+#define HOSTSIM_NVIC_ISER			(NVIC_BASE_ADDRESS + 0x000UL)
+#define HOSTSIM_NVIC_ICER			(NVIC_BASE_ADDRESS + 0x080UL)
+#define HOSTSIM_NVIC_ISPR			(NVIC_BASE_ADDRESS + 0x100UL)
+#define HOSTSIM_NVIC_ICPR			(NVIC_BASE_ADDRESS + 0x180UL)
+#define HOSTSIM_NVIC_IABR			(NVIC_BASE_ADDRESS + 0x200UL)
+#define HOSTSIM_NVIC_IPR			(NVIC_BASE_ADDRESS + 0x300UL)
+#define HOSTSIM_NVIC_STIR			(NVIC_BASE_ADDRESS + 0xE00UL)
+#define HOSTSIM_NVIC_REGS_NUM		8u
+#define HOSTSIM_NVIC_IRQS_NUM		97u
+#define HOSTSIM_SYSTEM_VECTORS_NUM	16u			/*IPSR of IRQ n: 16 + n*/
+
+#define HOSTSIM_DWT_CTRL			(DWT_BASE_ADDRESS + 0x00UL)
+#define HOSTSIM_DWT_CYCCNT			(DWT_BASE_ADDRESS + 0x04UL)
+#define HOSTSIM_DWT_CYCCNTENA		0x1UL
+
+#define HOSTSIM_SCB_AIRCR			0xE000ED0CUL
+#define HOSTSIM_SCB_VECTKEY			0x05FAUL
+#define HOSTSIM_SCB_VECTKEYSTAT		0xFA05UL
+#define HOSTSIM_SCB_PRIGROUP_MASK	0x700UL
+
+
+
+/******************* Private Types *******************/
+/*A simulated region: the bus view at the real address traps every access,
+ * the backing view is the same memory always accessible to the sim*/
+typedef struct
+{
+	uintptr_t Base;
+	uint32_t Size;
+	uint8_t * Backing;
+
+}HOSTSIM_Region_t;
+
+
+/*An access being single stepped*/
+typedef struct
+{
+	uintptr_t Address;				/*Register address (aligned word)*/
+	uintptr_t AliasAddress;			/*The alias word for bit-band accesses, 0 otherwise*/
+	uint8_t Bit;					/*The bit for bit-band accesses*/
+	uint8_t IsWrite;
+	uint32_t OldValue;
+	uintptr_t Page;
+
+}HOSTSIM_Access_t;
+
+
+typedef struct
+{
+	uintptr_t Address;
+	HOSTSIM_WriteHook_t WriteHook;
+	HOSTSIM_ReadHook_t ReadHook;
+
+}HOSTSIM_Hook_t;
+
+
+
+#endif
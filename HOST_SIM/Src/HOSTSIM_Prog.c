@@ -0,0 +1,901 @@
+/***************************************************************************************************
+ * @file: 			HOSTSIM_Prog.c
+ * @brief: 			This file contains the implementation of the host registers simulation
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "Stm32F446xx.h"
+
+#include "HOSTSIM_Interface.h"
+#include "HOSTSIM_Prv.h"
+
+
+#if !defined(__linux__) || !defined(__x86_64__)
+#error "HOSTSIM: the registers traps are implemented for x86-64 Linux hosts only"
+#endif
+
+
+
+/*
+ *
+ * @brief: The simulated regions, bus views at the real addresses
+ *
+ * */
+static HOSTSIM_Region_t HOSTSIM_Regions[] =
+{
+	{PERIPH_BB_REGION_BASE,	HOSTSIM_PERIPH_SIZE,	NULL},
+	{HOSTSIM_SCS_BASE,		HOSTSIM_SCS_SIZE,		NULL},
+	{DWT_BASE_ADDRESS,		HOSTSIM_DWT_SIZE,		NULL},
+};
+
+#define HOSTSIM_REGIONS_NUM		(sizeof(HOSTSIM_Regions) / sizeof(HOSTSIM_Regions[0]))
+
+
+static uint8_t HOSTSIM_u8Initialized = 0;
+static uintptr_t HOSTSIM_uptrPageSize;
+
+static HOSTSIM_Access_t HOSTSIM_Pending[HOSTSIM_MAX_PENDING];
+static uint8_t HOSTSIM_u8PendingNum = 0;
+
+static HOSTSIM_Hook_t HOSTSIM_Hooks[HOSTSIM_MAX_HOOKS];
+static uint8_t HOSTSIM_u8HooksNum = 0;
+
+static void (*HOSTSIM_IRQHandlers[HOSTSIM_NVIC_IRQS_NUM])(void);
+
+static HOSTSIM_BusStats_t HOSTSIM_BusStats;
+
+static void (*HOSTSIM_pWaitHook)(void) = NULL;
+
+/*The core BASEPRI, 0 masks nothing*/
+static uint8_t HOSTSIM_u8BasePri = 0;
+
+/*The core IPSR: the exception number (16 + IRQ) of the handler being run, 0 in thread mode*/
+static uint32_t HOSTSIM_u32IPSR = 0;
+
+/*LCKR key sequence progress & pins per port*/
+static uint8_t HOSTSIM_u8LockStep[HOSTSIM_GPIO_PORTS_NUM];
+static uint16_t HOSTSIM_u16LockPins[HOSTSIM_GPIO_PORTS_NUM];
+
+/*NVIC IRQ of each EXTI line, -1 when the line has no IRQ*/
+static const int8_t HOSTSIM_EXTILineIRQ[HOSTSIM_EXTI_LINES_NUM] =
+{
+	6, 7, 8, 9, 10,					/*EXTI0 ~ EXTI4*/
+	23, 23, 23, 23, 23,				/*EXTI9_5*/
+	40, 40, 40, 40, 40, 40,			/*EXTI15_10*/
+	1,								/*PVD*/
+	41,								/*RTC Alarm*/
+	42,								/*OTG FS wakeup*/
+	-1,								/*Reserved*/
+	76,								/*OTG HS wakeup*/
+	2,								/*Tamper & TimeStamp*/
+	3								/*RTC wakeup*/
+};
+
+
+
+/*
+ *
+ * @brief: Backing view access, never trapped
+ *
+ * */
+static HOSTSIM_Region_t * HOSTSIM_pFindRegion(uintptr_t Copy_uptrAddress)
+{
+	HOSTSIM_Region_t * Local_pRegion = NULL;
+	uint8_t Local_u8Counter;
+
+	for (Local_u8Counter = 0; Local_u8Counter < HOSTSIM_REGIONS_NUM; Local_u8Counter++)
+	{
+		if ((Copy_uptrAddress >= HOSTSIM_Regions[Local_u8Counter].Base) &&
+			(Copy_uptrAddress < (HOSTSIM_Regions[Local_u8Counter].Base + HOSTSIM_Regions[Local_u8Counter].Size)))
+		{
+			Local_pRegion = &HOSTSIM_Regions[Local_u8Counter];
+			break;
+		}
+	}
+
+	return Local_pRegion;
+}
+
+
+static volatile uint32_t * HOSTSIM_pu32Reg(uintptr_t Copy_uptrAddress)
+{
+	HOSTSIM_Region_t * Local_pRegion = HOSTSIM_pFindRegion(Copy_uptrAddress);
+
+	return (volatile uint32_t *)(Local_pRegion -> Backing + ((Copy_uptrAddress & ~3UL) - Local_pRegion -> Base));
+}
+
+
+uint32_t HOSTSIM_Peek(uintptr_t Copy_uptrAddress)
+{
+	return *HOSTSIM_pu32Reg(Copy_uptrAddress);
+}
+
+
+void HOSTSIM_Poke(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Value)
+{
+	*HOSTSIM_pu32Reg(Copy_uptrAddress) = Copy_u32Value;
+}
+
+
+
+/*
+ *
+ * @brief: Spreading a pins mask over 2 or 4 bits fields, e.g. for the MODER or AFR locked pins
+ *
+ * */
+static uint32_t HOSTSIM_u32SpreadMask(uint16_t Copy_u16Pins, uint8_t Copy_u8FieldWidth, uint8_t Copy_u8FirstPin)
+{
+	uint32_t Local_u32Mask = 0;
+	uint8_t Local_u8Pin;
+
+	for (Local_u8Pin = 0; (Local_u8Pin * Copy_u8FieldWidth) < 32u; Local_u8Pin++)
+	{
+		if ((Copy_u16Pins >> (Local_u8Pin + Copy_u8FirstPin)) & 1u)
+		{
+			Local_u32Mask |= (((1UL << Copy_u8FieldWidth) - 1u) << (Local_u8Pin * Copy_u8FieldWidth));
+		}
+	}
+
+	return Local_u32Mask;
+}
+
+
+
+/*
+ *
+ * @brief: EXTI lines to NVIC: a line pending & unmasked keeps its IRQ pending
+ *
+ * */
+static void HOSTSIM_vidPendEXTILines(void)
+{
+	uint32_t Local_u32Lines = HOSTSIM_Peek(HOSTSIM_EXTI_PR) & HOSTSIM_Peek(HOSTSIM_EXTI_IMR);
+	uint8_t Local_u8Line;
+
+	for (Local_u8Line = 0; Local_u8Line < HOSTSIM_EXTI_LINES_NUM; Local_u8Line++)
+	{
+		if (((Local_u32Lines >> Local_u8Line) & 1u) && (HOSTSIM_EXTILineIRQ[Local_u8Line] >= 0))
+		{
+			uint8_t Local_u8IRQ = (uint8_t)HOSTSIM_EXTILineIRQ[Local_u8Line];
+			uintptr_t Local_uptrISPR = HOSTSIM_NVIC_ISPR + ((Local_u8IRQ / 32u) * 4u);
+			uint32_t Local_u32Pending = HOSTSIM_Peek(Local_uptrISPR) | (1UL << (Local_u8IRQ % 32u));
+			uint32_t Local_u32Active = HOSTSIM_Peek(HOSTSIM_NVIC_IABR + ((Local_u8IRQ / 32u) * 4u));
+
+			/*Level signal: an active IRQ is pended again only on its exit if the line is still pending*/
+			if (((Local_u32Active >> (Local_u8IRQ % 32u)) & 1u) == 0u)
+			{
+				HOSTSIM_Poke(Local_uptrISPR, Local_u32Pending);
+				HOSTSIM_Poke(Local_uptrISPR + (HOSTSIM_NVIC_ICPR - HOSTSIM_NVIC_ISPR), Local_u32Pending);
+			}
+		}
+	}
+}
+
+
+void HOSTSIM_RaiseEXTILine(uint8_t Copy_u8Line)
+{
+	if (Copy_u8Line < HOSTSIM_EXTI_LINES_NUM)
+	{
+		/*PR is set by the edge even if the line is masked*/
+		HOSTSIM_Poke(HOSTSIM_EXTI_PR, HOSTSIM_Peek(HOSTSIM_EXTI_PR) | (1UL << Copy_u8Line));
+		HOSTSIM_vidPendEXTILines();
+	}
+}
+
+
+void HOSTSIM_SetPinLevel(uint8_t Copy_u8Port, uint8_t Copy_u8Pin, uint8_t Copy_u8Level)
+{
+	if ((Copy_u8Port < HOSTSIM_GPIO_PORTS_NUM) && (Copy_u8Pin < 16u))
+	{
+		uintptr_t Local_uptrIDR = GPIOA_BASE_ADDRESS + (Copy_u8Port * HOSTSIM_GPIO_PORT_SIZE) + HOSTSIM_GPIO_IDR;
+		uint32_t Local_u32IDR = HOSTSIM_Peek(Local_uptrIDR);
+		uint8_t Local_u8OldLevel = (Local_u32IDR >> Copy_u8Pin) & 1u;
+		uint32_t Local_u32EXTICR = HOSTSIM_Peek(HOSTSIM_SYSCFG_EXTICR + ((Copy_u8Pin / 4u) * 4u));
+		uint8_t Local_u8RoutedPort = (Local_u32EXTICR >> ((Copy_u8Pin % 4u) * 4u)) & 0xFu;
+
+		Local_u32IDR = (Local_u32IDR & ~(1UL << Copy_u8Pin)) | ((uint32_t)(Copy_u8Level & 1u) << Copy_u8Pin);
+		HOSTSIM_Poke(Local_uptrIDR, Local_u32IDR);
+
+		if ((Local_u8RoutedPort == Copy_u8Port) && (Local_u8OldLevel != (Copy_u8Level & 1u)))
+		{
+			uint32_t Local_u32Edges = (Copy_u8Level & 1u) ? HOSTSIM_Peek(HOSTSIM_EXTI_RTSR) : HOSTSIM_Peek(HOSTSIM_EXTI_FTSR);
+
+			if ((Local_u32Edges >> Copy_u8Pin) & 1u)
+			{
+				HOSTSIM_RaiseEXTILine(Copy_u8Pin);
+			}
+		}
+	}
+}
+
+
+
+/*
+ *
+ * @brief: Built-in side effects of the modeled registers, returns the value held after the write
+ *
+ * */
+static uint32_t HOSTSIM_u32GPIOWrite(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Old, uint32_t Copy_u32New)
+{
+	uint32_t Local_u32Stored = Copy_u32New;
+	uint8_t Local_u8Port = (Copy_uptrAddress - GPIOA_BASE_ADDRESS) / HOSTSIM_GPIO_PORT_SIZE;
+	uintptr_t Local_uptrPortBase = GPIOA_BASE_ADDRESS + (Local_u8Port * HOSTSIM_GPIO_PORT_SIZE);
+	/*The written register already holds the new value in the backing view*/
+	uint32_t Local_u32LCKR = ((Copy_uptrAddress - Local_uptrPortBase) == HOSTSIM_GPIO_LCKR) ? Copy_u32Old : HOSTSIM_Peek(Local_uptrPortBase + HOSTSIM_GPIO_LCKR);
+	uint16_t Local_u16Locked = ((Local_u32LCKR >> HOSTSIM_GPIO_LCKK) & 1u) ? (uint16_t)Local_u32LCKR : 0u;
+	uint32_t Local_u32Frozen = 0;
+
+	switch (Copy_uptrAddress - Local_uptrPortBase)
+	{
+		case HOSTSIM_GPIO_MODER:
+		case HOSTSIM_GPIO_OSPEEDR:
+		case HOSTSIM_GPIO_PUPDR:	Local_u32Frozen = HOSTSIM_u32SpreadMask(Local_u16Locked, 2u, 0u); break;
+		case HOSTSIM_GPIO_OTYPER:	Local_u32Frozen = Local_u16Locked; break;
+		case HOSTSIM_GPIO_AFRL:		Local_u32Frozen = HOSTSIM_u32SpreadMask(Local_u16Locked, 4u, 0u); break;
+		case HOSTSIM_GPIO_AFRH:		Local_u32Frozen = HOSTSIM_u32SpreadMask(Local_u16Locked, 4u, 8u); break;
+
+		/*Input, driven by HOSTSIM_SetPinLevel only*/
+		case HOSTSIM_GPIO_IDR:		Local_u32Stored = Copy_u32Old; break;
+
+		case HOSTSIM_GPIO_ODR:		Local_u32Stored = Copy_u32New & 0xFFFFu; break;
+
+		case HOSTSIM_GPIO_BSRR:
+		{
+			/*Set has priority over reset, BSRR reads 0*/
+			uint32_t Local_u32ODR = HOSTSIM_Peek(Local_uptrPortBase + HOSTSIM_GPIO_ODR);
+
+			Local_u32ODR = (Local_u32ODR & ~(Copy_u32New >> 16)) | (Copy_u32New & 0xFFFFu);
+			HOSTSIM_Poke(Local_uptrPortBase + HOSTSIM_GPIO_ODR, Local_u32ODR & 0xFFFFu);
+			Local_u32Stored = 0;
+			break;
+		}
+
+		case HOSTSIM_GPIO_LCKR:
+		{
+			uint8_t Local_u8Key = (Copy_u32New >> HOSTSIM_GPIO_LCKK) & 1u;
+			uint16_t Local_u16Pins = (uint16_t)Copy_u32New;
+
+			Local_u32Stored = Copy_u32Old;
+
+			if (Local_u16Locked == 0u)
+			{
+				/*WR 1+pins, WR 0+pins, WR 1+pins with the same pins, any other write restarts the sequence*/
+				if ((Local_u8Key == 1u) && (HOSTSIM_u8LockStep[Local_u8Port] == 2u) && (Local_u16Pins == HOSTSIM_u16LockPins[Local_u8Port]))
+				{
+					Local_u32Stored = (1UL << HOSTSIM_GPIO_LCKK) | Local_u16Pins;
+					HOSTSIM_u8LockStep[Local_u8Port] = 0;
+				}
+
+				else if ((Local_u8Key == 0u) && (HOSTSIM_u8LockStep[Local_u8Port] == 1u) && (Local_u16Pins == HOSTSIM_u16LockPins[Local_u8Port]))
+				{
+					HOSTSIM_u8LockStep[Local_u8Port] = 2;
+					Local_u32Stored = Local_u16Pins;
+				}
+
+				else if (Local_u8Key == 1u)
+				{
+					HOSTSIM_u8LockStep[Local_u8Port] = 1;
+					HOSTSIM_u16LockPins[Local_u8Port] = Local_u16Pins;
+					Local_u32Stored = Local_u16Pins;
+				}
+
+				else
+				{
+					HOSTSIM_u8LockStep[Local_u8Port] = 0;
+					Local_u32Stored = Local_u16Pins;
+				}
+			}
+
+			break;
+		}
+
+		default: break;
+	}
+
+	return (Local_u32Stored & ~Local_u32Frozen) | (Copy_u32Old & Local_u32Frozen);
+}
+
+
+static uint32_t HOSTSIM_u32EXTIWrite(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Old, uint32_t Copy_u32New)
+{
+	uint32_t Local_u32Stored = Copy_u32New;
+
+	switch (Copy_uptrAddress)
+	{
+		case HOSTSIM_EXTI_PR:
+		{
+			/*Write 1 to clear, clearing PR clears the SWIER bit too*/
+			Local_u32Stored = Copy_u32Old & ~Copy_u32New;
+			HOSTSIM_Poke(HOSTSIM_EXTI_SWIER, HOSTSIM_Peek(HOSTSIM_EXTI_SWIER) & ~Copy_u32New);
+			break;
+		}
+
+		case HOSTSIM_EXTI_SWIER:
+		{
+			/*Writing 1 over 0 sets the pending bit of an unmasked line*/
+			uint32_t Local_u32Raised = (Copy_u32New & ~Copy_u32Old) & HOSTSIM_Peek(HOSTSIM_EXTI_IMR);
+
+			Local_u32Stored = Copy_u32Old | Copy_u32New;
+			HOSTSIM_Poke(HOSTSIM_EXTI_PR, HOSTSIM_Peek(HOSTSIM_EXTI_PR) | Local_u32Raised);
+			break;
+		}
+
+		default: break;
+	}
+
+	return Local_u32Stored & ((1UL << HOSTSIM_EXTI_LINES_NUM) - 1u);
+}
+
+
+static uint32_t HOSTSIM_u32SCSWrite(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Old, uint32_t Copy_u32New)
+{
+	uint32_t Local_u32Stored = Copy_u32New;
+
+	if ((Copy_uptrAddress >= HOSTSIM_NVIC_ISER) && (Copy_uptrAddress < HOSTSIM_NVIC_IABR))
+	{
+		/*ISER/ICER both read the enabled state, ISPR/ICPR both read the pending state*/
+		uintptr_t Local_uptrOffset = (Copy_uptrAddress - HOSTSIM_NVIC_ISER) % 0x100UL;
+		uint8_t Local_u8IsClear = (Local_uptrOffset >= 0x80UL);
+		uintptr_t Local_uptrSet = Copy_uptrAddress - (Local_u8IsClear ? 0x80UL : 0UL);
+
+		Local_u32Stored = Local_u8IsClear ? (Copy_u32Old & ~Copy_u32New) : (Copy_u32Old | Copy_u32New);
+
+		HOSTSIM_Poke(Local_uptrSet, Local_u32Stored);
+		HOSTSIM_Poke(Local_uptrSet + 0x80UL, Local_u32Stored);
+	}
+
+	else if ((Copy_uptrAddress >= HOSTSIM_NVIC_IABR) && (Copy_uptrAddress < HOSTSIM_NVIC_IPR))
+	{
+		Local_u32Stored = Copy_u32Old;
+	}
+
+	else if (Copy_uptrAddress == HOSTSIM_NVIC_STIR)
+	{
+		uint32_t Local_u32IRQ = Copy_u32New & 0x1FFu;
+
+		if (Local_u32IRQ < HOSTSIM_NVIC_IRQS_NUM)
+		{
+			uintptr_t Local_uptrISPR = HOSTSIM_NVIC_ISPR + ((Local_u32IRQ / 32u) * 4u);
+			uint32_t Local_u32Pending = HOSTSIM_Peek(Local_uptrISPR) | (1UL << (Local_u32IRQ % 32u));
+
+			HOSTSIM_Poke(Local_uptrISPR, Local_u32Pending);
+			HOSTSIM_Poke(Local_uptrISPR + 0x80UL, Local_u32Pending);
+		}
+
+		Local_u32Stored = 0;
+	}
+
+	else if (Copy_uptrAddress == HOSTSIM_SCB_AIRCR)
+	{
+		/*Ignored without the key, reads back VECTKEYSTAT*/
+		if ((Copy_u32New >> 16) == HOSTSIM_SCB_VECTKEY)
+		{
+			Local_u32Stored = (HOSTSIM_SCB_VECTKEYSTAT << 16) | (Copy_u32New & HOSTSIM_SCB_PRIGROUP_MASK);
+		}
+
+		else
+		{
+			Local_u32Stored = Copy_u32Old;
+		}
+	}
+
+	return Local_u32Stored;
+}
+
+
+static uint32_t HOSTSIM_u32ApplyWrite(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Old, uint32_t Copy_u32New)
+{
+	uint32_t Local_u32Stored = Copy_u32New;
+	uint8_t Local_u8Counter;
+	uint8_t Local_u8Hooked = 0;
+
+	for (Local_u8Counter = 0; Local_u8Counter < HOSTSIM_u8HooksNum; Local_u8Counter++)
+	{
+		if ((HOSTSIM_Hooks[Local_u8Counter].Address == Copy_uptrAddress) && (HOSTSIM_Hooks[Local_u8Counter].WriteHook != NULL))
+		{
+			Local_u32Stored = HOSTSIM_Hooks[Local_u8Counter].WriteHook(Copy_uptrAddress, Copy_u32Old, Copy_u32New);
+			Local_u8Hooked = 1;
+			break;
+		}
+	}
+
+	if (Local_u8Hooked == 0)
+	{
+		if ((Copy_uptrAddress >= GPIOA_BASE_ADDRESS) && (Copy_uptrAddress < (GPIOA_BASE_ADDRESS + (HOSTSIM_GPIO_PORTS_NUM * HOSTSIM_GPIO_PORT_SIZE))))
+		{
+			Local_u32Stored = HOSTSIM_u32GPIOWrite(Copy_uptrAddress, Copy_u32Old, Copy_u32New);
+		}
+
+		else if ((Copy_uptrAddress >= EXTI_BASE_ADDRESS) && (Copy_uptrAddress <= HOSTSIM_EXTI_PR))
+		{
+			Local_u32Stored = HOSTSIM_u32EXTIWrite(Copy_uptrAddress, Copy_u32Old, Copy_u32New);
+		}
+
+		else if (Copy_uptrAddress == HOSTSIM_RCC_CR)
+		{
+			Local_u32Stored = (Copy_u32New & ~HOSTSIM_RCC_CR_RDY_BITS) | ((Copy_u32New & HOSTSIM_RCC_CR_ON_BITS) << 1);
+		}
+
+		else if (Copy_uptrAddress == HOSTSIM_RCC_CFGR)
+		{
+			Local_u32Stored = (Copy_u32New & ~HOSTSIM_RCC_CFGR_SWS) | ((Copy_u32New & HOSTSIM_RCC_CFGR_SW) << 2);
+		}
+
+		else if (Copy_uptrAddress >= HOSTSIM_SCS_BASE)
+		{
+			Local_u32Stored = HOSTSIM_u32SCSWrite(Copy_uptrAddress, Copy_u32Old, Copy_u32New);
+		}
+
+		else
+		{
+			/*Plain store*/
+		}
+	}
+
+	return Local_u32Stored;
+}
+
+
+static uint32_t HOSTSIM_u32ApplyRead(uintptr_t Copy_uptrAddress, uint32_t Copy_u32Value)
+{
+	uint32_t Local_u32Value = Copy_u32Value;
+	uint8_t Local_u8Counter;
+
+	for (Local_u8Counter = 0; Local_u8Counter < HOSTSIM_u8HooksNum; Local_u8Counter++)
+	{
+		if ((HOSTSIM_Hooks[Local_u8Counter].Address == Copy_uptrAddress) && (HOSTSIM_Hooks[Local_u8Counter].ReadHook != NULL))
+		{
+			Local_u32Value = HOSTSIM_Hooks[Local_u8Counter].ReadHook(Copy_uptrAddress, Copy_u32Value);
+			break;
+		}
+	}
+
+	return Local_u32Value;
+}
+
+
+
+/*
+ *
+ * @brief: Traps: the faulting access is recorded, its page opened and the instruction single stepped,
+ * 			then the side effects are applied and the page closed again
+ *
+ * */
+static void HOSTSIM_vidFaultHandler(int Copy_s32Signal, siginfo_t * Copy_pInfo, void * Copy_pContext)
+{
+	ucontext_t * Local_pContext = (ucontext_t *)Copy_pContext;
+	uintptr_t Local_uptrFault = (uintptr_t)(Copy_pInfo -> si_addr);
+	HOSTSIM_Region_t * Local_pRegion = HOSTSIM_pFindRegion(Local_uptrFault);
+	HOSTSIM_Access_t * Local_pAccess = &HOSTSIM_Pending[HOSTSIM_u8PendingNum];
+	uint8_t Local_u8IsWrite = ((Local_pContext -> uc_mcontext.gregs[REG_ERR] & HOSTSIM_X86_PF_WRITE) != 0);
+
+	(void)Copy_s32Signal;
+
+	if (HOSTSIM_u8PendingNum >= HOSTSIM_MAX_PENDING)
+	{
+		Local_pRegion = NULL;
+	}
+
+	if (Local_pRegion != NULL)
+	{
+		volatile uint32_t * Local_pu32Reg = HOSTSIM_pu32Reg(Local_uptrFault);
+
+		Local_pAccess -> Address = Local_uptrFault & ~3UL;
+		Local_pAccess -> AliasAddress = 0;
+
+		if (!Local_u8IsWrite)
+		{
+			*Local_pu32Reg = HOSTSIM_u32ApplyRead(Local_pAccess -> Address, *Local_pu32Reg);
+		}
+	}
+
+	else if ((HOSTSIM_u8PendingNum < HOSTSIM_MAX_PENDING) &&
+			 (Local_uptrFault >= PERIPH_BB_ALIAS_BASE) && (Local_uptrFault < (PERIPH_BB_ALIAS_BASE + HOSTSIM_ALIAS_SIZE)))
+	{
+		/*Alias word -> register bit, the alias page is filled with the bit value for the step*/
+		uintptr_t Local_uptrByte = PERIPH_BB_REGION_BASE + ((Local_uptrFault - PERIPH_BB_ALIAS_BASE) / 32u);
+		uint8_t Local_u8Bit = (((Local_uptrFault - PERIPH_BB_ALIAS_BASE) % 32u) / 4u) + ((Local_uptrByte & 3u) * 8u);
+
+		Local_pAccess -> Address = Local_uptrByte & ~3UL;
+		Local_pAccess -> AliasAddress = Local_uptrFault & ~3UL;
+		Local_pAccess -> Bit = Local_u8Bit;
+		Local_pRegion = HOSTSIM_pFindRegion(Local_pAccess -> Address);
+
+		mprotect((void *)(Local_uptrFault & ~(HOSTSIM_uptrPageSize - 1u)), HOSTSIM_uptrPageSize, PROT_READ | PROT_WRITE);
+		*(volatile uint32_t *)(Local_pAccess -> AliasAddress) = (HOSTSIM_u32ApplyRead(Local_pAccess -> Address, HOSTSIM_Peek(Local_pAccess -> Address)) >> Local_u8Bit) & 1u;
+	}
+
+	else
+	{
+		/*Not a simulated address: a real crash*/
+		signal(SIGSEGV, SIG_DFL);
+		return;
+	}
+
+	Local_pAccess -> IsWrite = Local_u8IsWrite;
+	Local_pAccess -> OldValue = HOSTSIM_Peek(Local_pAccess -> Address);
+	Local_pAccess -> Page = Local_uptrFault & ~(HOSTSIM_uptrPageSize - 1u);
+	HOSTSIM_u8PendingNum++;
+
+	if (Local_u8IsWrite)
+	{
+		HOSTSIM_BusStats.Writes++;
+	}
+
+	else
+	{
+		HOSTSIM_BusStats.Reads++;
+	}
+
+	mprotect((void *)(Local_pAccess -> Page), HOSTSIM_uptrPageSize, PROT_READ | PROT_WRITE);
+	Local_pContext -> uc_mcontext.gregs[REG_EFL] |= HOSTSIM_X86_TRAP_FLAG;
+}
+
+
+static void HOSTSIM_vidStepHandler(int Copy_s32Signal, siginfo_t * Copy_pInfo, void * Copy_pContext)
+{
+	ucontext_t * Local_pContext = (ucontext_t *)Copy_pContext;
+	uint8_t Local_u8Counter;
+
+	(void)Copy_s32Signal;
+	(void)Copy_pInfo;
+
+	for (Local_u8Counter = 0; Local_u8Counter < HOSTSIM_u8PendingNum; Local_u8Counter++)
+	{
+		HOSTSIM_Access_t * Local_pAccess = &HOSTSIM_Pending[Local_u8Counter];
+
+		if (Local_pAccess -> IsWrite)
+		{
+			uint32_t Local_u32Written;
+
+			if (Local_pAccess -> AliasAddress != 0u)
+			{
+				/*The core does a read-modify-write of the whole register*/
+				uint32_t Local_u32BitMask = (1UL << Local_pAccess -> Bit);
+
+				Local_u32Written = (*(volatile uint32_t *)(Local_pAccess -> AliasAddress) & 1u) ?
+								   (Local_pAccess -> OldValue | Local_u32BitMask) : (Local_pAccess -> OldValue & ~Local_u32BitMask);
+			}
+
+			else
+			{
+				Local_u32Written = HOSTSIM_Peek(Local_pAccess -> Address);
+			}
+
+			HOSTSIM_Poke(Local_pAccess -> Address, HOSTSIM_u32ApplyWrite(Local_pAccess -> Address, Local_pAccess -> OldValue, Local_u32Written));
+		}
+
+		mprotect((void *)(Local_pAccess -> Page), HOSTSIM_uptrPageSize, PROT_NONE);
+	}
+
+	if (HOSTSIM_u8PendingNum != 0u)
+	{
+		HOSTSIM_u8PendingNum = 0;
+		HOSTSIM_vidPendEXTILines();
+	}
+
+	Local_pContext -> uc_mcontext.gregs[REG_EFL] &= ~HOSTSIM_X86_TRAP_FLAG;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to map the simulated registers and install the traps
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_Init(void)
+{
+	HOSTSIM_ErrorStates_t Local_u8ErrorState = HOSTSIM_Exit_OK;
+	uint8_t Local_u8Counter;
+
+	if (HOSTSIM_u8Initialized == 0u)
+	{
+		struct sigaction Local_Action;
+
+		HOSTSIM_uptrPageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+
+		for (Local_u8Counter = 0; (Local_u8Counter < HOSTSIM_REGIONS_NUM) && (Local_u8ErrorState == HOSTSIM_Exit_OK); Local_u8Counter++)
+		{
+			HOSTSIM_Region_t * Local_pRegion = &HOSTSIM_Regions[Local_u8Counter];
+			int Local_s32Fd = memfd_create("hostsim", 0);
+			void * Local_pBus;
+
+			if ((Local_s32Fd < 0) || (ftruncate(Local_s32Fd, Local_pRegion -> Size) != 0))
+			{
+				Local_u8ErrorState = HOSTSIM_MapFailed;
+				break;
+			}
+
+			Local_pRegion -> Backing = mmap(NULL, Local_pRegion -> Size, PROT_READ | PROT_WRITE, MAP_SHARED, Local_s32Fd, 0);
+			Local_pBus = mmap((void *)(Local_pRegion -> Base), Local_pRegion -> Size, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, Local_s32Fd, 0);
+			close(Local_s32Fd);
+
+			if ((Local_pRegion -> Backing == MAP_FAILED) || (Local_pBus != (void *)(Local_pRegion -> Base)))
+			{
+				Local_u8ErrorState = HOSTSIM_MapFailed;
+			}
+		}
+
+		if (Local_u8ErrorState == HOSTSIM_Exit_OK)
+		{
+			if (mmap((void *)PERIPH_BB_ALIAS_BASE, HOSTSIM_ALIAS_SIZE, PROT_NONE,
+					 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0) != (void *)PERIPH_BB_ALIAS_BASE)
+			{
+				Local_u8ErrorState = HOSTSIM_MapFailed;
+			}
+		}
+
+		if (Local_u8ErrorState == HOSTSIM_Exit_OK)
+		{
+			memset(&Local_Action, 0, sizeof(Local_Action));
+			Local_Action.sa_flags = SA_SIGINFO;
+			sigemptyset(&Local_Action.sa_mask);
+
+			Local_Action.sa_sigaction = HOSTSIM_vidFaultHandler;
+			sigaction(SIGSEGV, &Local_Action, NULL);
+
+			Local_Action.sa_sigaction = HOSTSIM_vidStepHandler;
+			sigaction(SIGTRAP, &Local_Action, NULL);
+
+			HOSTSIM_u8Initialized = 1;
+		}
+	}
+
+	if (Local_u8ErrorState == HOSTSIM_Exit_OK)
+	{
+		HOSTSIM_Reset();
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to put back all the registers to their reset values
+ *************************************************************************************************************/
+void HOSTSIM_Reset(void)
+{
+	uint8_t Local_u8Counter;
+
+	for (Local_u8Counter = 0; Local_u8Counter < HOSTSIM_REGIONS_NUM; Local_u8Counter++)
+	{
+		memset(HOSTSIM_Regions[Local_u8Counter].Backing, 0, HOSTSIM_Regions[Local_u8Counter].Size);
+	}
+
+	/*Non-zero reset values used by the drivers*/
+	HOSTSIM_Poke(HOSTSIM_RCC_CR, 0x00000083UL);
+	HOSTSIM_Poke(GPIOA_BASE_ADDRESS + HOSTSIM_GPIO_MODER,   0xA8000000UL);
+	HOSTSIM_Poke(GPIOA_BASE_ADDRESS + HOSTSIM_GPIO_OSPEEDR, 0x0C000000UL);
+	HOSTSIM_Poke(GPIOA_BASE_ADDRESS + HOSTSIM_GPIO_PUPDR,   0x64000000UL);
+	HOSTSIM_Poke(GPIOB_BASE_ADDRESS + HOSTSIM_GPIO_MODER,   0x00000280UL);
+	HOSTSIM_Poke(GPIOB_BASE_ADDRESS + HOSTSIM_GPIO_OSPEEDR, 0x000000C0UL);
+	HOSTSIM_Poke(GPIOB_BASE_ADDRESS + HOSTSIM_GPIO_PUPDR,   0x00000100UL);
+	HOSTSIM_Poke(HOSTSIM_SCB_AIRCR, (HOSTSIM_SCB_VECTKEYSTAT << 16));
+
+	memset(HOSTSIM_u8LockStep, 0, sizeof(HOSTSIM_u8LockStep));
+	memset(HOSTSIM_IRQHandlers, 0, sizeof(HOSTSIM_IRQHandlers));
+	memset(&HOSTSIM_BusStats, 0, sizeof(HOSTSIM_BusStats));
+	HOSTSIM_u8HooksNum = 0;
+	HOSTSIM_pWaitHook = NULL;
+	HOSTSIM_u8BasePri = 0;
+	HOSTSIM_u32IPSR = 0;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to model the side effects of a register not modeled by the sim
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_SetHooks(uintptr_t Copy_uptrAddress, HOSTSIM_WriteHook_t Copy_pWriteHook, HOSTSIM_ReadHook_t Copy_pReadHook)
+{
+	HOSTSIM_ErrorStates_t Local_u8ErrorState = HOSTSIM_Exit_OK;
+
+	if ((HOSTSIM_pFindRegion(Copy_uptrAddress) != NULL) && (HOSTSIM_u8HooksNum < HOSTSIM_MAX_HOOKS))
+	{
+		HOSTSIM_Hooks[HOSTSIM_u8HooksNum].Address = Copy_uptrAddress & ~3UL;
+		HOSTSIM_Hooks[HOSTSIM_u8HooksNum].WriteHook = Copy_pWriteHook;
+		HOSTSIM_Hooks[HOSTSIM_u8HooksNum].ReadHook = Copy_pReadHook;
+		HOSTSIM_u8HooksNum++;
+	}
+
+	else
+	{
+		Local_u8ErrorState = HOSTSIM_InvalidAddress;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to attach an IRQ handler
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_SetIRQHandler(uint8_t Copy_u8IRQNum, void (*Copy_pHandler)(void))
+{
+	HOSTSIM_ErrorStates_t Local_u8ErrorState = HOSTSIM_Exit_OK;
+
+	if (Copy_u8IRQNum < HOSTSIM_NVIC_IRQS_NUM)
+	{
+		HOSTSIM_IRQHandlers[Copy_u8IRQNum] = Copy_pHandler;
+	}
+
+	else
+	{
+		Local_u8ErrorState = HOSTSIM_InvalidIRQ;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to run the handlers of the enabled & pending IRQs
+ *************************************************************************************************************/
+uint32_t HOSTSIM_RunPendingIRQs(void)
+{
+	uint32_t Local_u32Runs = 0;
+	uint8_t Local_u8Found = 1;
+
+	while ((Local_u8Found != 0u) && (Local_u32Runs < HOSTSIM_MAX_IRQ_RUNS))
+	{
+		uint8_t Local_u8IRQ;
+		uint8_t Local_u8Selected = 0;
+		uint8_t Local_u8SelectedPriority = 0xFF;
+		uint8_t Local_u8Reg;
+		uint32_t Local_u32Bit;
+
+		Local_u8Found = 0;
+
+		/*Highest priority (lowest value) first, lowest IRQ number on ties, the IRQs masked by BASEPRI stay pending*/
+		for (Local_u8IRQ = 0; Local_u8IRQ < HOSTSIM_NVIC_IRQS_NUM; Local_u8IRQ++)
+		{
+			uint32_t Local_u32Ready = HOSTSIM_Peek(HOSTSIM_NVIC_ISER + ((Local_u8IRQ / 32u) * 4u)) & HOSTSIM_Peek(HOSTSIM_NVIC_ISPR + ((Local_u8IRQ / 32u) * 4u));
+			uint8_t Local_u8Priority = (HOSTSIM_Peek(HOSTSIM_NVIC_IPR + (Local_u8IRQ & ~3u)) >> ((Local_u8IRQ % 4u) * 8u)) & 0xFFu;
+			uint8_t Local_u8Masked = (HOSTSIM_u8BasePri != 0u) && (Local_u8Priority >= HOSTSIM_u8BasePri);
+
+			if (((Local_u32Ready >> (Local_u8IRQ % 32u)) & 1u) && (Local_u8Masked == 0u) && ((Local_u8Found == 0u) || (Local_u8Priority < Local_u8SelectedPriority)))
+			{
+				Local_u8Selected = Local_u8IRQ;
+				Local_u8SelectedPriority = Local_u8Priority;
+				Local_u8Found = 1;
+			}
+		}
+
+		if (Local_u8Found != 0u)
+		{
+			Local_u8Reg = (Local_u8Selected / 32u) * 4u;
+			Local_u32Bit = (1UL << (Local_u8Selected % 32u));
+
+			/*Pending -> active*/
+			HOSTSIM_Poke(HOSTSIM_NVIC_ISPR + Local_u8Reg, HOSTSIM_Peek(HOSTSIM_NVIC_ISPR + Local_u8Reg) & ~Local_u32Bit);
+			HOSTSIM_Poke(HOSTSIM_NVIC_ICPR + Local_u8Reg, HOSTSIM_Peek(HOSTSIM_NVIC_ISPR + Local_u8Reg));
+			HOSTSIM_Poke(HOSTSIM_NVIC_IABR + Local_u8Reg, HOSTSIM_Peek(HOSTSIM_NVIC_IABR + Local_u8Reg) | Local_u32Bit);
+
+			if (HOSTSIM_IRQHandlers[Local_u8Selected] != NULL)
+			{
+				/*A handler calling HOSTSIM_RunPendingIRQs nests the next ones, IPSR is back to its own on their return*/
+				uint32_t Local_u32PrevIPSR = HOSTSIM_u32IPSR;
+
+				HOSTSIM_u32IPSR = HOSTSIM_SYSTEM_VECTORS_NUM + Local_u8Selected;
+				HOSTSIM_IRQHandlers[Local_u8Selected]();
+				HOSTSIM_u32IPSR = Local_u32PrevIPSR;
+			}
+
+			HOSTSIM_Poke(HOSTSIM_NVIC_IABR + Local_u8Reg, HOSTSIM_Peek(HOSTSIM_NVIC_IABR + Local_u8Reg) & ~Local_u32Bit);
+			Local_u32Runs++;
+
+			/*EXTI lines still pending re-pend their IRQ on exit*/
+			HOSTSIM_vidPendEXTILines();
+		}
+	}
+
+	return Local_u32Runs;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get & clear the bus accesses done to the simulated registers
+ *************************************************************************************************************/
+HOSTSIM_ErrorStates_t HOSTSIM_GetBusStats(HOSTSIM_BusStats_t *Copy_pStats)
+{
+	HOSTSIM_ErrorStates_t Local_u8ErrorState = HOSTSIM_Exit_OK;
+
+	if (Copy_pStats != NULL)
+	{
+		*Copy_pStats = HOSTSIM_BusStats;
+		memset(&HOSTSIM_BusStats, 0, sizeof(HOSTSIM_BusStats));
+	}
+
+	else
+	{
+		Local_u8ErrorState = HOSTSIM_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to advance the DWT cycle counter, if enabled
+ *************************************************************************************************************/
+void HOSTSIM_AdvanceCycles(uint32_t Copy_u32Cycles)
+{
+	if(HOSTSIM_Peek(HOSTSIM_DWT_CTRL) & HOSTSIM_DWT_CYCCNTENA)
+	{
+		HOSTSIM_Poke(HOSTSIM_DWT_CYCCNT, HOSTSIM_Peek(HOSTSIM_DWT_CYCCNT) + Copy_u32Cycles);
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the func run by the core WFE/WFI
+ *************************************************************************************************************/
+void HOSTSIM_SetWaitHook(void (*Copy_pWaitHook)(void))
+{
+	HOSTSIM_pWaitHook = Copy_pWaitHook;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is what CORE_WFE()/CORE_WFI() run under MCAL_HOST_SIM
+ *************************************************************************************************************/
+void HOSTSIM_WaitForEvent(void)
+{
+	if(HOSTSIM_pWaitHook != NULL)
+	{
+		HOSTSIM_pWaitHook();
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 These Functions are what the BASEPRI accesses of CortexM4_Core.h run under MCAL_HOST_SIM,
+ * 								BASEPRI_MAX only raises the masking (a lower non zero value) as on the core
+ *************************************************************************************************************/
+uint32_t HOSTSIM_GetBasePri(void)
+{
+	return HOSTSIM_u8BasePri;
+}
+
+
+void HOSTSIM_SetBasePri(uint32_t Copy_u32BasePri)
+{
+	HOSTSIM_u8BasePri = (uint8_t)Copy_u32BasePri;
+}
+
+
+void HOSTSIM_SetBasePriMax(uint32_t Copy_u32BasePri)
+{
+	uint8_t Local_u8BasePri = (uint8_t)Copy_u32BasePri;
+
+	if((Local_u8BasePri != 0u) && ((HOSTSIM_u8BasePri == 0u) || (Local_u8BasePri < HOSTSIM_u8BasePri)))
+	{
+		HOSTSIM_u8BasePri = Local_u8BasePri;
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is what CORE_GET_IPSR() of CortexM4_Core.h runs under MCAL_HOST_SIM
+ *************************************************************************************************************/
+uint32_t HOSTSIM_GetIPSR(void)
+{
+	return HOSTSIM_u32IPSR;
+}
@@ -0,0 +1,83 @@
+/***************************************************************************************************
+ * @file: 			CortexM4_Core.h
+ * @brief: 			This file contains the Cortex-M4 core instructions used by the drivers, with their
+ * 					host fallbacks when built with MCAL_HOST_SIM
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef CORTEXM4_CORE_H
+#define CORTEXM4_CORE_H
+
+
+
+#ifndef MCAL_HOST_SIM
+
+/******************* Sleep & Events *******************/
+#define CORE_WFE()		__asm__ volatile ("wfe" ::: "memory")		/*Wait for an event (or an event already latched)*/
+#define CORE_WFI()		__asm__ volatile ("wfi" ::: "memory")		/*Wait for an interrupt*/
+#define CORE_SEV()		__asm__ volatile ("sev" ::: "memory")		/*Latch an event*/
+
+/******************* Barriers *******************/
+#define CORE_DSB()		__asm__ volatile ("dsb 0xF" ::: "memory")
+#define CORE_ISB()		__asm__ volatile ("isb 0xF" ::: "memory")
+
+/******************* Priority Masking *******************/
+/*BASEPRI masks the IRQs whose priority byte is >= its value (0 masks nothing), BASEPRI_MAX only raises the masking*/
+#define CORE_GET_BASEPRI()				CORE_u32ReadBasePri()
+#define CORE_SET_BASEPRI(VALUE)			__asm__ volatile ("msr basepri, %0" :: "r" (VALUE) : "memory")
+#define CORE_SET_BASEPRI_MAX(VALUE)		__asm__ volatile ("msr basepri_max, %0" :: "r" (VALUE) : "memory")
+
+static inline uint32_t CORE_u32ReadBasePri(void)
+{
+	uint32_t Local_u32BasePri;
+
+	__asm__ volatile ("mrs %0, basepri" : "=r" (Local_u32BasePri) :: "memory");
+
+	return Local_u32BasePri;
+}
+
+/******************* Exception Status *******************/
+/*IPSR: the exception number being handled (16 + IRQ for the IRQs), 0 in thread mode*/
+#define CORE_GET_IPSR()					CORE_u32ReadIPSR()
+
+static inline uint32_t CORE_u32ReadIPSR(void)
+{
+	uint32_t Local_u32IPSR;
+
+	__asm__ volatile ("mrs %0, ipsr" : "=r" (Local_u32IPSR));
+
+	return Local_u32IPSR;
+}
+
+#else
+
+/*HOST_SIM: WFE/WFI run the sim wait hook (edges injection, cycles advance...), the barriers only order the compiler*/
+void HOSTSIM_WaitForEvent(void);
+
+#define CORE_WFE()		HOSTSIM_WaitForEvent()
+#define CORE_WFI()		HOSTSIM_WaitForEvent()
+#define CORE_SEV()		((void)0)
+
+#define CORE_DSB()		__asm__ volatile ("" ::: "memory")
+#define CORE_ISB()		__asm__ volatile ("" ::: "memory")
+
+/*HOST_SIM: BASEPRI is kept by the sim, the masked IRQs aren't run by HOSTSIM_RunPendingIRQs*/
+uint32_t HOSTSIM_GetBasePri(void);
+void HOSTSIM_SetBasePri(uint32_t Copy_u32BasePri);
+void HOSTSIM_SetBasePriMax(uint32_t Copy_u32BasePri);
+
+#define CORE_GET_BASEPRI()				HOSTSIM_GetBasePri()
+#define CORE_SET_BASEPRI(VALUE)			HOSTSIM_SetBasePri(VALUE)
+#define CORE_SET_BASEPRI_MAX(VALUE)		HOSTSIM_SetBasePriMax(VALUE)
+
+/*HOST_SIM: IPSR follows the handlers run by HOSTSIM_RunPendingIRQs*/
+uint32_t HOSTSIM_GetIPSR(void);
+
+#define CORE_GET_IPSR()					HOSTSIM_GetIPSR()
+
+#endif
+
+
+
+#endif
@@ -0,0 +1,52 @@
+/***************************************************************************************************
+ * @file: 			MCAL_Config.h
+ * @brief: 			This file contains the build configs shared by all the MCAL drivers
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef MCAL_CONFIG_H
+#define MCAL_CONFIG_H
+
+
+
+/******************* Params Runtime Checks *******************/
+#define MCAL_CHECKS_OFF		0u
+#define MCAL_CHECKS_ON		1u
+
+/*
+ * MCAL_CHECKS_ON:  (debug) the drivers validate their params ranges (pin, port, line, IRQ...), a failed check calls
+ * 					MCAL_PARAM_ERROR_HOOK then the func returns its error state as usual.
+ * MCAL_CHECKS_OFF: (release) the range checks are removed at compile time, the params are trusted to be valid
+ * 					enum values, NULL ptrs checks are kept.
+ * Can be selected from the compiler: -DMCAL_PARAM_CHECKS=0
+ */
+#ifndef MCAL_PARAM_CHECKS
+#define MCAL_PARAM_CHECKS		MCAL_CHECKS_ON
+#endif
+
+
+/*Debug hook called on a failed check with the file & line of the check, e.g. a breakpoint or a logger*/
+#ifndef MCAL_PARAM_ERROR_HOOK
+#define MCAL_PARAM_ERROR_HOOK(FILE, LINE)		((void)0)
+#endif
+
+
+#if MCAL_PARAM_CHECKS == MCAL_CHECKS_ON
+#define MCAL_PARAM_VALID(COND)		((COND) ? 1 : (MCAL_PARAM_ERROR_HOOK(__FILE__, __LINE__), 0))
+#else
+#define MCAL_PARAM_VALID(COND)		(1)
+#endif
+
+
+
+/******************* Host Simulation *******************/
+/*
+ * Defined (-DMCAL_HOST_SIM) when the drivers are built for the host against HOST_SIM: the registers stay accessed
+ * through the same base addresses, HOST_SIM maps them & models their side effects. Only the core instructions
+ * (WFE, BASEPRI...) need a host fallback, selected with this define.
+ */
+
+
+
+#endif
@@ -26,6 +26,8 @@
 /*@todo: add systic*/
 #define NVIC_BASE_ADDRESS	 	0xE000E100UL
 #define SCB_BASE_ADDRESS		0xE000E008UL
+#define DWT_BASE_ADDRESS		0xE0001000UL
+#define COREDEBUG_BASE_ADDRESS	0xE000EDF0UL
 
 
 
@@ -35,6 +37,13 @@
 #define ROM_BASE_ADDRESS		0x1FFF0000UL
 
 
+											/******************* Bit-Band Regions Base Addresses *******************/
+#define SRAM_BB_REGION_BASE		0x20000000UL
+#define SRAM_BB_ALIAS_BASE		0x22000000UL
+#define PERIPH_BB_REGION_BASE	0x40000000UL
+#define PERIPH_BB_ALIAS_BASE	0x42000000UL
+
+
 											/******************* AHB1 Peripheral Base Addresses *******************/
 #define GPIOA_BASE_ADDRESS		0x40020000U			
 #define GPIOB_BASE_ADDRESS      0x40020400U 
@@ -130,13 +139,41 @@ typedef struct
 	volatile uint32_t IABR[8];              /*Interrupt Active Bit Registers*/
 	volatile uint32_t RERSERVED5[56];
 	volatile uint8_t  IPR[240];              /*Interrupt priority Registers*/
-	volatile uint32_t RERSERVED6[643];
+	volatile uint32_t RERSERVED6[644];
 	volatile uint32_t STIR;					/*Software Trigger Interrupt Register*/
 
 }NVIC_RegDef_t;
 
 
 
+/******************* DWT Registers Definition Structures *******************/
+typedef struct
+{
+	volatile uint32_t CTRL;					/*Control Register*/
+	volatile uint32_t CYCCNT;				/*Cycle Count Register*/
+	volatile uint32_t CPICNT;				/*CPI Count Register*/
+	volatile uint32_t EXCCNT;				/*Exception Overhead Count Register*/
+	volatile uint32_t SLEEPCNT;				/*Sleep Count Register*/
+	volatile uint32_t LSUCNT;				/*LSU Count Register*/
+	volatile uint32_t FOLDCNT;				/*Folded-instruction Count Register*/
+	volatile uint32_t PCSR;					/*Program Counter Sample Register*/
+
+}DWT_RegDef_t;
+
+
+
+/******************* CoreDebug Registers Definition Structures *******************/
+typedef struct
+{
+	volatile uint32_t DHCSR;				/*Debug Halting Control and Status Register*/
+	volatile uint32_t DCRSR;				/*Debug Core Register Selector Register*/
+	volatile uint32_t DCRDR;				/*Debug Core Register Data Register*/
+	volatile uint32_t DEMCR;				/*Debug Exception and Monitor Control Register*/
+
+}CoreDebug_RegDef_t;
+
+
+
 
 
 											/******************* AHB1 Peripheral Registers Definition Structures *******************/
@@ -259,6 +296,10 @@ typedef struct
 /******************* NVIC Peripheral Definition *******************/
 #define NVIC	((NVIC_RegDef_t *) NVIC_BASE_ADDRESS)
 
+/******************* DWT & CoreDebug Peripheral Definitions *******************/
+#define DWT			((DWT_RegDef_t *) DWT_BASE_ADDRESS)
+#define COREDEBUG	((CoreDebug_RegDef_t *) COREDEBUG_BASE_ADDRESS)
+
 
 
 
@@ -314,18 +355,27 @@ typedef struct
 
 
 
+																	/*********************
 
+																   	Bit-Band Alias Access
 
+																	**********************/
 
-
-
-
-
-
-
-
-
-
+/*
+ * Every bit of the 0x40000000~0x400FFFFF peripheral region (GPIO, RCC, SYSCFG, EXTI...) has a word in the alias region:
+ * 		alias = ALIAS_BASE + (REG_ADDRESS - REGION_BASE) * 32 + BIT * 4
+ * A store to the alias word sets/clears that single bit atomically, no read-modify-write on the register.
+ * The address is folded at compile time when the register & bit are constants, e.g:
+ * 		BITBAND_PERIPH(EXTI -> IMR, 13) = 1;
+ * 		BITBAND_PERIPH(GPIOA -> ODR, 5) = 0;
+ * Not for the write-1-to-clear registers (e.g. EXTI PR): the core still reads & writes back the whole register,
+ * so all their set bits are cleared.
+ */
+#define BITBAND_PERIPH_ALIAS_ADDRESS(REG_ADDRESS, BIT)	(PERIPH_BB_ALIAS_BASE + (((REG_ADDRESS) - PERIPH_BB_REGION_BASE) * 32UL) + ((BIT) * 4UL))
+#define BITBAND_SRAM_ALIAS_ADDRESS(VAR_ADDRESS, BIT)	(SRAM_BB_ALIAS_BASE + (((VAR_ADDRESS) - SRAM_BB_REGION_BASE) * 32UL) + ((BIT) * 4UL))
+
+#define BITBAND_PERIPH(REG, BIT)	(*((volatile uint32_t *) BITBAND_PERIPH_ALIAS_ADDRESS((uintptr_t) &(REG), (BIT))))
+#define BITBAND_SRAM(VAR, BIT)		(*((volatile uint32_t *) BITBAND_SRAM_ALIAS_ADDRESS((uintptr_t) &(VAR), (BIT))))
 
 
 
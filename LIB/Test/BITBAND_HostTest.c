@@ -0,0 +1,101 @@
+/***************************************************************************************************
+ * @file: 			BITBAND_HostTest.c
+ * @brief: 			Host tests of the bit-band alias access (Stm32F446xx.h): the alias address math against
+ * 					reference addresses (checked at compile time too), then single bit stores & loads through
+ * 					the aliases on the registers simulation (HOST_SIM). Returns the failures count.
+ * 					Build (from the repo root):
+ * 						gcc -std=gnu11 -O2 -DMCAL_HOST_SIM -ILIB -IHOST_SIM/Inc \
+ * 							LIB/Test/BITBAND_HostTest.c HOST_SIM/Src/HOSTSIM_Prog.c -o bitband_test
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+#include "Stm32F446xx.h"
+#include "HOSTSIM_Interface.h"
+
+
+#define TEST_CHECK(COND)		TEST_vidCheck((COND), #COND, __LINE__)
+
+
+/*Reference aliases: region & alias bases of the Cortex-M4 TRM, registers offsets of RM0390*/
+#define TEST_GPIOA_ODR				0x40020014UL
+#define TEST_EXTI_IMR				0x40013C00UL
+#define TEST_EXTI_PR				0x40013C14UL
+
+_Static_assert(BITBAND_PERIPH_ALIAS_ADDRESS(TEST_GPIOA_ODR, 5) == 0x42400294UL, "GPIOA ODR bit 5 alias");
+_Static_assert(BITBAND_PERIPH_ALIAS_ADDRESS(TEST_EXTI_IMR, 13) == 0x42278034UL, "EXTI IMR bit 13 alias");
+_Static_assert(BITBAND_PERIPH_ALIAS_ADDRESS(PERIPH_BB_REGION_BASE, 0) == PERIPH_BB_ALIAS_BASE, "region start");
+_Static_assert(BITBAND_PERIPH_ALIAS_ADDRESS(0x400FFFFCUL, 31) == 0x43FFFFFCUL, "region last bit");
+_Static_assert(BITBAND_SRAM_ALIAS_ADDRESS(0x20000300UL, 2) == 0x22006008UL, "TRM SRAM example");
+
+
+static uint32_t TEST_u32Fails = 0;
+
+
+
+static void TEST_vidCheck(int Copy_Cond, const char *Copy_pcCond, int Copy_Line)
+{
+	if(!Copy_Cond)
+	{
+		printf("FAIL line %d: %s\n", Copy_Line, Copy_pcCond);
+		TEST_u32Fails++;
+	}
+}
+
+
+
+int main(void)
+{
+	uint8_t Local_u8Bit;
+
+	HOSTSIM_Init();
+
+	/*The macros fold the registers of the drivers to the same aliases as the reference addresses*/
+	TEST_CHECK(&BITBAND_PERIPH(GPIOA -> ODR, 5) == (volatile uint32_t *)0x42400294UL);
+	TEST_CHECK(&BITBAND_PERIPH(EXTI -> IMR, 13) == (volatile uint32_t *)0x42278034UL);
+	TEST_CHECK(&BITBAND_PERIPH(EXTI -> PR, 0) == (volatile uint32_t *)BITBAND_PERIPH_ALIAS_ADDRESS(TEST_EXTI_PR, 0));
+
+	/*Each alias word of ODR sets & clears its bit only, and reads it back as 0/1*/
+	GPIOA -> ODR = 0x0000A5A5UL;
+
+	for(Local_u8Bit = 0; Local_u8Bit < 16u; Local_u8Bit++)
+	{
+		uint32_t Local_u32Before = GPIOA -> ODR;
+
+		BITBAND_PERIPH(GPIOA -> ODR, Local_u8Bit) = 1;
+		TEST_CHECK((GPIOA -> ODR) == (Local_u32Before | (1UL << Local_u8Bit)));
+		TEST_CHECK(BITBAND_PERIPH(GPIOA -> ODR, Local_u8Bit) == 1u);
+
+		BITBAND_PERIPH(GPIOA -> ODR, Local_u8Bit) = 0;
+		TEST_CHECK((GPIOA -> ODR) == (Local_u32Before & ~(1UL << Local_u8Bit)));
+		TEST_CHECK(BITBAND_PERIPH(GPIOA -> ODR, Local_u8Bit) == 0u);
+	}
+
+	/*Only bit 0 of the stored word counts*/
+	GPIOA -> ODR = 0;
+	BITBAND_PERIPH(GPIOA -> ODR, 3) = 0xFFFFFFFEUL;
+	TEST_CHECK((GPIOA -> ODR) == 0u);
+
+	/*IMR up to its last line (22), the other lines untouched*/
+	EXTI -> IMR = 0;
+	BITBAND_PERIPH(EXTI -> IMR, 13) = 1;
+	BITBAND_PERIPH(EXTI -> IMR, 22) = 1;
+	TEST_CHECK((EXTI -> IMR) == ((1UL << 13) | (1UL << 22)));
+	BITBAND_PERIPH(EXTI -> IMR, 13) = 0;
+	TEST_CHECK((EXTI -> IMR) == (1UL << 22));
+
+	/*PR is write-1-to-clear: the alias store is a read-modify-write of the whole word, so it writes back
+	 * the other pending lines as 1 and clears them too. The drivers write PR directly for that reason*/
+	HOSTSIM_RaiseEXTILine(2);
+	HOSTSIM_RaiseEXTILine(9);
+	TEST_CHECK((EXTI -> PR) == ((1UL << 2) | (1UL << 9)));
+	BITBAND_PERIPH(EXTI -> PR, 9) = 1;
+	TEST_CHECK((EXTI -> PR) == 0u);
+
+	printf("%s (%u failures)\n", (TEST_u32Fails == 0u) ? "ALL OK" : "FAILED", (unsigned)TEST_u32Fails);
+
+	return (int)TEST_u32Fails;
+}
@@ -0,0 +1,33 @@
+/***************************************************************************************************
+ * @file: 			CRITICAL_Config.h
+ * @brief: 			This file contains the build configs of the critical sections driver
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef CRITICAL_CONFIG_H
+#define CRITICAL_CONFIG_H
+
+
+
+/******************* Latency Tracking *******************/
+#define CRITICAL_TRACKING_OFF		0u
+#define CRITICAL_TRACKING_ON		1u
+
+/*
+ * CRITICAL_TRACKING_ON:  each section is timed from its entry to its exit, the worst one is kept for CRITICAL_GetStats()
+ * CRITICAL_TRACKING_OFF: the sections only mask & restore BASEPRI
+ */
+#ifndef CRITICAL_TRACKING
+#define CRITICAL_TRACKING			CRITICAL_TRACKING_ON
+#endif
+
+
+/*Timestamp of the sections entry & exit, any free-running uint32_t counter. The DWT cycle counter by default (DWT_Init() must be called)*/
+#ifndef CRITICAL_TIMESTAMP
+#define CRITICAL_TIMESTAMP()		(DWT -> CYCCNT)
+#endif
+
+
+
+#endif
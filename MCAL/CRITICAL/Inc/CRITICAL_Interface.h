@@ -0,0 +1,111 @@
+/***************************************************************************************************
+ * @file: 			CRITICAL_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes of the critical sections: BASEPRI based,
+ * 					only the IRQs at or below a priority are masked, the higher ones keep running
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef CRITICAL_INTERFACE_H
+#define CRITICAL_INTERFACE_H
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the critical sections funcs*/
+typedef enum
+{
+	CRITICAL_Exit_OK,
+	CRITICAL_NULL_Ptr_Err,
+	CRITICAL_InvalidPriority
+
+}CRITICAL_ErrorStates_t;
+
+
+
+										/******************		Interfacing Structs		****************/
+/*A section state, a local of the caller from CRITICAL_Enter() to CRITICAL_Exit()*/
+typedef struct
+{
+	uint32_t SavedBasePri;				/*BASEPRI before the entry, restored at the exit*/
+	uint32_t EntryStamp;				/*CRITICAL_TIMESTAMP() at the entry*/
+	uint8_t Priority;
+
+}CRITICAL_Section_t;
+
+
+/*The worst section measured*/
+typedef struct
+{
+	uint32_t MaxCycles;					/*Longest section in CRITICAL_TIMESTAMP() ticks*/
+	uint8_t MaxPriority;				/*Its masking priority: the IRQs of this priority & below waited up to MaxCycles*/
+	uint32_t Sections;					/*Sections exited*/
+
+}CRITICAL_Stats_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enter a critical section: the IRQs whose NVIC priority is
+ * 								Copy_u8Priority or lower (a value >= Copy_u8Priority) are masked through BASEPRI_MAX,
+ * 								the higher ones still preempt. Sections nest, an inner one never lowers the masking
+ * 	Parameters:                 - CRITICAL_Section_t *Copy_pSection: the section state, passed to CRITICAL_Exit()
+ * 								- uint8_t Copy_u8Priority: the masking priority 1 ~ 15, the highest priority of the
+ * 								  ISRs sharing the protected state
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC priorities are set per NVIC_SetPriority (4 bits), DWT_Init() for the tracking
+ * 	Side effects:               The masked IRQs stay pending until the exit
+ * 	Post Conditions:            The section is entered
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_Enter(CRITICAL_Section_t *Copy_pSection, uint8_t Copy_u8Priority);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to exit a critical section, BASEPRI is restored to its value
+ * 								before the matching CRITICAL_Enter()
+ * 	Parameters:                 - const CRITICAL_Section_t *Copy_pSection: the state filled by CRITICAL_Enter()
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The sections are exited in the reverse order of their entries
+ * 	Side effects:               The pending IRQs unmasked are taken right after
+ * 	Post Conditions:            The section is exited
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_Exit(const CRITICAL_Section_t *Copy_pSection);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the worst case latency added by the sections: the longest
+ * 								one & its masking priority
+ * 	Parameters:                 - CRITICAL_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  CRITICAL_TRACKING is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_GetStats(CRITICAL_Stats_t *Copy_pStats);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the stats, e.g. once the startup is done
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are zeroed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void CRITICAL_ResetStats(void);
+
+
+
+#endif
@@ -0,0 +1,21 @@
+/***************************************************************************************************
+ * @file: 			CRITICAL_Prv.h
+ * @brief: 			This file contains the private definitions of the critical sections driver
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef CRITICAL_PRV_H
+#define CRITICAL_PRV_H
+
+#define NULL ((void *)0)
+
+
+/*4 implemented priority bits, the upper nibble of BASEPRI as for the IPR bytes*/
+#define CRITICAL_PRIORITY_SHIFT		4u
+#define CRITICAL_PRIORITY_MIN		1u			/*BASEPRI 0 masks nothing*/
+#define CRITICAL_PRIORITY_MAX		15u
+
+
+
+#endif
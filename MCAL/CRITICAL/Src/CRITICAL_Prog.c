@@ -0,0 +1,175 @@
+/***************************************************************************************************
+ * @file: 			CRITICAL_Prog.c
+ * @brief: 			This file contains the implementation of the BASEPRI critical sections
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdint.h>
+
+#include "Stm32F446xx.h"
+#include "MCAL_Config.h"
+#include "CortexM4_Core.h"
+
+#include "CRITICAL_Config.h"
+#include "CRITICAL_Prv.h"
+#include "CRITICAL_Interface.h"
+
+
+#if CRITICAL_TRACKING == CRITICAL_TRACKING_ON
+/*
+ *
+ * @brief: The worst section measured, updated at the exits while still masked. A higher priority ISR exiting its own
+ * 		   section in between may lose an update: the stats are best effort, the masking itself is exact
+ *
+ * */
+static volatile CRITICAL_Stats_t CRITICAL_Stats = {0};
+#endif
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enter a critical section: the IRQs whose NVIC priority is
+ * 								Copy_u8Priority or lower (a value >= Copy_u8Priority) are masked through BASEPRI_MAX,
+ * 								the higher ones still preempt. Sections nest, an inner one never lowers the masking
+ * 	Parameters:                 - CRITICAL_Section_t *Copy_pSection: the section state, passed to CRITICAL_Exit()
+ * 								- uint8_t Copy_u8Priority: the masking priority 1 ~ 15, the highest priority of the
+ * 								  ISRs sharing the protected state
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC priorities are set per NVIC_SetPriority (4 bits), DWT_Init() for the tracking
+ * 	Side effects:               The masked IRQs stay pending until the exit
+ * 	Post Conditions:            The section is entered
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_Enter(CRITICAL_Section_t *Copy_pSection, uint8_t Copy_u8Priority)
+{
+	CRITICAL_ErrorStates_t Local_u8ErrorState = CRITICAL_Exit_OK;
+
+	if(Copy_pSection != NULL)
+	{
+		if(MCAL_PARAM_VALID((Copy_u8Priority >= CRITICAL_PRIORITY_MIN) && (Copy_u8Priority <= CRITICAL_PRIORITY_MAX)))
+		{
+			Copy_pSection -> SavedBasePri = CORE_GET_BASEPRI();
+			Copy_pSection -> Priority = Copy_u8Priority;
+
+			/*BASEPRI_MAX: ignored when the current masking is already higher (an outer section or a higher ISR's one)*/
+			CORE_SET_BASEPRI_MAX((uint32_t)Copy_u8Priority << CRITICAL_PRIORITY_SHIFT);
+
+#if CRITICAL_TRACKING == CRITICAL_TRACKING_ON
+			Copy_pSection -> EntryStamp = CRITICAL_TIMESTAMP();
+#endif
+		}
+		else
+		{
+			Local_u8ErrorState = CRITICAL_InvalidPriority;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = CRITICAL_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to exit a critical section, BASEPRI is restored to its value
+ * 								before the matching CRITICAL_Enter()
+ * 	Parameters:                 - const CRITICAL_Section_t *Copy_pSection: the state filled by CRITICAL_Enter()
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The sections are exited in the reverse order of their entries
+ * 	Side effects:               The pending IRQs unmasked are taken right after
+ * 	Post Conditions:            The section is exited
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_Exit(const CRITICAL_Section_t *Copy_pSection)
+{
+	CRITICAL_ErrorStates_t Local_u8ErrorState = CRITICAL_Exit_OK;
+
+	if(Copy_pSection != NULL)
+	{
+#if CRITICAL_TRACKING == CRITICAL_TRACKING_ON
+		/*Measured before the restore: the ISRs this section masked can't run in between*/
+		uint32_t Local_u32Cycles = CRITICAL_TIMESTAMP() - (Copy_pSection -> EntryStamp);
+
+		if(Local_u32Cycles > CRITICAL_Stats.MaxCycles)
+		{
+			CRITICAL_Stats.MaxCycles = Local_u32Cycles;
+			CRITICAL_Stats.MaxPriority = Copy_pSection -> Priority;
+		}
+
+		CRITICAL_Stats.Sections++;
+#endif
+
+		CORE_SET_BASEPRI(Copy_pSection -> SavedBasePri);
+		CORE_ISB();
+	}
+	else
+	{
+		Local_u8ErrorState = CRITICAL_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the worst case latency added by the sections: the longest
+ * 								one & its masking priority
+ * 	Parameters:                 - CRITICAL_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - CRITICAL_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  CRITICAL_TRACKING is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+CRITICAL_ErrorStates_t CRITICAL_GetStats(CRITICAL_Stats_t *Copy_pStats)
+{
+	CRITICAL_ErrorStates_t Local_u8ErrorState = CRITICAL_Exit_OK;
+
+	if(Copy_pStats != NULL)
+	{
+#if CRITICAL_TRACKING == CRITICAL_TRACKING_ON
+		Copy_pStats -> MaxCycles = CRITICAL_Stats.MaxCycles;
+		Copy_pStats -> MaxPriority = CRITICAL_Stats.MaxPriority;
+		Copy_pStats -> Sections = CRITICAL_Stats.Sections;
+#else
+		Copy_pStats -> MaxCycles = 0u;
+		Copy_pStats -> MaxPriority = 0u;
+		Copy_pStats -> Sections = 0u;
+#endif
+	}
+	else
+	{
+		Local_u8ErrorState = CRITICAL_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the stats, e.g. once the startup is done
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are zeroed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void CRITICAL_ResetStats(void)
+{
+#if CRITICAL_TRACKING == CRITICAL_TRACKING_ON
+	CRITICAL_Stats.MaxCycles = 0u;
+	CRITICAL_Stats.MaxPriority = 0u;
+	CRITICAL_Stats.Sections = 0u;
+#endif
+}
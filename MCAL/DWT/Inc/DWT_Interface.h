@@ -0,0 +1,71 @@
+/***************************************************************************************************
+ * @file: 			DWT_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes for the DWT cycle counter (CYCCNT),
+ * 					a free running 32-bit counter of the core clk used for timestamps
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef DWT_INTERFACE_H
+#define DWT_INTERFACE_H
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the DWT funcs*/
+typedef enum
+{
+	DWT_Exit_OK,
+	DWT_NULL_Ptr_Err,
+	DWT_InvalidClk,
+	DWT_NoCycleCounter
+
+}DWT_ErrorStates_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable & reset the cycle counter
+ * 	Parameters:                 - uint32_t Copy_u32CoreClkHz: the core (HCLK) clk, used for the cycles to ns conversion
+ * 	Returns:                    - DWT_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               Enables the trace (TRCENA) in CoreDebug DEMCR
+ * 	Post Conditions:            CYCCNT counts from 0 and wraps every 2^32 cycles (~23.8 s at 180 MHz)
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DWT_ErrorStates_t DWT_Init(uint32_t Copy_u32CoreClkHz);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to read the cycle counter
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: CYCCNT, differences of two reads are wrap safe with uint32_t arithmetic
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            None
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+uint32_t DWT_u32GetCycles(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to convert a cycles count to nanoseconds
+ * 	Parameters:                 - uint32_t Copy_u32Cycles: the cycles count
+ * 								- uint32_t *Copy_pu32Ns: ptr to receive the ns, saturated to 0xFFFFFFFF
+ * 	Returns:                    - DWT_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The ns are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+DWT_ErrorStates_t DWT_CyclesToNs(uint32_t Copy_u32Cycles, uint32_t *Copy_pu32Ns);
+
+
+
+#endif
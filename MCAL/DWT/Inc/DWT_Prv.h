@@ -0,0 +1,22 @@
+/***************************************************************************************************
+ * @file: 			DWT_Prv.h
+ * @brief: 			This file contains the private definitions for the DWT cycle counter
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef DWT_PRV_H
+#define DWT_PRV_H
+
+
+#define DWT_DEMCR_TRCENA		24u			/*Enables the DWT & ITM units*/
+#define DWT_CTRL_CYCCNTENA		0u			/*Enables CYCCNT*/
+#define DWT_CTRL_NOCYCCNT		25u			/*Reads 1 if CYCCNT isn't implemented*/
+
+#define DWT_NS_PER_SEC			1000000000ULL
+
+#define NULL ((void *)0)
+
+
+
+#endif
@@ -0,0 +1,121 @@
+/***************************************************************************************************
+ * @file: 			DWT_Prog.c
+ * @brief: 			This file contains the implementation for the DWT cycle counter
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdint.h>
+
+#include "Stm32F446xx.h"
+#include "MCAL_Config.h"
+
+#include "DWT_Prv.h"
+#include "DWT_Interface.h"
+
+
+/*
+ *
+ * @brief: The core clk given to DWT_Init, 0 until then
+ *
+ * */
+static uint32_t DWT_u32CoreClkHz = 0;
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable & reset the cycle counter
+ * 	Parameters:                 - uint32_t Copy_u32CoreClkHz: the core (HCLK) clk, used for the cycles to ns conversion
+ * 	Returns:                    - DWT_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               Enables the trace (TRCENA) in CoreDebug DEMCR
+ * 	Post Conditions:            CYCCNT counts from 0 and wraps every 2^32 cycles (~23.8 s at 180 MHz)
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+DWT_ErrorStates_t DWT_Init(uint32_t Copy_u32CoreClkHz)
+{
+	DWT_ErrorStates_t Local_u8ErrorState = DWT_Exit_OK;
+
+	if(MCAL_PARAM_VALID(Copy_u32CoreClkHz != 0u))
+	{
+		COREDEBUG -> DEMCR |= (1UL << DWT_DEMCR_TRCENA);
+
+		if(((DWT -> CTRL) >> DWT_CTRL_NOCYCCNT) & 1u)
+		{
+			Local_u8ErrorState = DWT_NoCycleCounter;
+		}
+
+		else
+		{
+			DWT_u32CoreClkHz = Copy_u32CoreClkHz;
+
+			DWT -> CYCCNT = 0;
+			DWT -> CTRL |= (1UL << DWT_CTRL_CYCCNTENA);
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = DWT_InvalidClk;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to read the cycle counter
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: CYCCNT, differences of two reads are wrap safe with uint32_t arithmetic
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            None
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+uint32_t DWT_u32GetCycles(void)
+{
+	return DWT -> CYCCNT;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to convert a cycles count to nanoseconds
+ * 	Parameters:                 - uint32_t Copy_u32Cycles: the cycles count
+ * 								- uint32_t *Copy_pu32Ns: ptr to receive the ns, saturated to 0xFFFFFFFF
+ * 	Returns:                    - DWT_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The ns are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+DWT_ErrorStates_t DWT_CyclesToNs(uint32_t Copy_u32Cycles, uint32_t *Copy_pu32Ns)
+{
+	DWT_ErrorStates_t Local_u8ErrorState = DWT_Exit_OK;
+
+	if(Copy_pu32Ns != NULL)
+	{
+		if(DWT_u32CoreClkHz != 0u)
+		{
+			uint64_t Local_u64Ns = ((uint64_t)Copy_u32Cycles * DWT_NS_PER_SEC) / DWT_u32CoreClkHz;
+
+			*Copy_pu32Ns = (Local_u64Ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)Local_u64Ns;
+		}
+
+		else
+		{
+			Local_u8ErrorState = DWT_InvalidClk;
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = DWT_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
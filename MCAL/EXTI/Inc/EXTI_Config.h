@@ -0,0 +1,74 @@
+/***************************************************************************************************
+ * @file: 			EXTI_Config.h
+ * @brief: 			This file contains the build configs of the EXTI driver
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef EXTI_CONFIG_H
+#define EXTI_CONFIG_H
+
+
+
+/******************* Deferred Events Queue *******************/
+/*Number of events the ISRs can queue before EXTI_ProcessEvents() drains them, must be a power of 2*/
+#ifndef EXTI_EVENT_QUEUE_SIZE
+#define EXTI_EVENT_QUEUE_SIZE		32u
+#endif
+
+
+/*Timestamp taken at the ISR entry for the deferred events & the captures, any free-running uint32_t counter.
+ * The DWT cycle counter by default (DWT_Init() must be called), e.g. a timer CNT can be used instead*/
+#ifndef EXTI_EVENT_TIMESTAMP
+#define EXTI_EVENT_TIMESTAMP()		(DWT -> CYCCNT)
+#endif
+
+
+
+/******************* Edges Capture *******************/
+/*Number of the last edges timestamps kept per line in capture mode, must be a power of 2 & <= 32*/
+#ifndef EXTI_CAPTURE_BUFFER_SIZE
+#define EXTI_CAPTURE_BUFFER_SIZE	8u
+#endif
+
+
+
+/******************* Storm Guard *******************/
+#define EXTI_STORM_GUARD_OFF		0u
+#define EXTI_STORM_GUARD_ON			1u
+
+/*
+ * EXTI_STORM_GUARD_ON:  each serviced edge is counted per line, a line exceeding its limit (EXTI_SetStormLimit) is
+ * 						 masked from its ISR and re-armed by EXTI_StormTick() after its cooldown. Uses EXTI_EVENT_TIMESTAMP().
+ * EXTI_STORM_GUARD_OFF: the lines are dispatched without any accounting, the storm funcs have no effect.
+ */
+#ifndef EXTI_STORM_GUARD
+#define EXTI_STORM_GUARD			EXTI_STORM_GUARD_ON
+#endif
+
+
+
+/******************* Pulse Counting *******************/
+/*Rate of the EXTI_FreqTick() calls (e.g. from the SysTick ISR), the gate windows are counted in these ticks*/
+#ifndef EXTI_FREQ_TICK_HZ
+#define EXTI_FREQ_TICK_HZ			1000u
+#endif
+
+
+
+/******************* Profiling *******************/
+#define EXTI_PROFILING_OFF			0u
+#define EXTI_PROFILING_ON			1u
+
+/*
+ * EXTI_PROFILING_ON:  each line serviced by the shared handlers (EXTI9_5, EXTI15_10) is timed by the IRQs profiler
+ * 					   (MCAL/IRQPROF, linked with the driver), see IRQPROF_GetLineStats()
+ * EXTI_PROFILING_OFF: no accounting
+ */
+#ifndef EXTI_PROFILING
+#define EXTI_PROFILING				EXTI_PROFILING_OFF
+#endif
+
+
+
+#endif
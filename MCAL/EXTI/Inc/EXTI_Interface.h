@@ -19,6 +19,13 @@ typedef enum
 	EXTI_InvalidLineNumber,
 	EXTI_InvalidEdgeType,
 	EXTI_InvalidInitState,
+	EXTI_InvalidLineMode,
+	EXTI_QueueEmpty,
+	EXTI_NotEnoughCaptures,
+	EXTI_InvalidTimeUnit,
+	EXTI_Timeout,
+	EXTI_InvalidStormLimit,
+	EXTI_NoMeasurement,
 
 
 }EXTI_ErrorStates_t;
@@ -42,7 +49,15 @@ typedef enum
 	EXTI12,
 	EXTI13,
 	EXTI14,
-	EXTI15
+	EXTI15,
+
+	/*Internal lines, no SYSCFG port selection*/
+	EXTI16_PVD,						/*PVD output*/
+	EXTI17_RTC_ALARM,				/*RTC Alarm A & B*/
+	EXTI18_OTG_FS_WKUP,				/*USB OTG FS wakeup*/
+	EXTI20_OTG_HS_WKUP = 20,		/*USB OTG HS wakeup, line 19 is reserved*/
+	EXTI21_TAMP_STAMP,				/*RTC Tamper & TimeStamp*/
+	EXTI22_RTC_WKUP					/*RTC Wakeup timer*/
 
 
 }EXTI_ExtIntLine_t;
@@ -68,6 +83,58 @@ typedef enum
 }EXTI_IntState_t;
 
 
+
+/*How a raised line is handled by its IRQ*/
+typedef enum
+{
+	EXTI_MODE_CALLBACK,			/*The callback runs inside the ISR (default)*/
+	EXTI_MODE_DEFERRED,			/*The ISR only queues an event, the callback runs from EXTI_ProcessEvents()*/
+	EXTI_MODE_CAPTURE,			/*The ISR only records the edge timestamp, read back by EXTI_GetPeriod()...*/
+	EXTI_MODE_COUNTER			/*The ISR only increments the line count, read back by EXTI_GetCount() & EXTI_GetFrequency()*/
+
+}EXTI_LineMode_t;
+
+
+/*Unit of the captured times*/
+typedef enum
+{
+	EXTI_UNIT_CYCLES,
+	EXTI_UNIT_NS				/*Converted by DWT_CyclesToNs(), the timestamps must be DWT cycles*/
+
+}EXTI_TimeUnit_t;
+
+
+/*A deferred event*/
+typedef struct
+{
+	uint8_t Line;				/*EXTI_ExtIntLine_t*/
+	uint8_t Edge;				/*EXTI_RisingEdge or EXTI_FallingEdge, EXTI_OnChange for an internal line triggering on both*/
+	uint32_t TimeStamp;			/*EXTI_EVENT_TIMESTAMP() at the ISR entry*/
+
+}EXTI_Event_t;
+
+
+/*A line storm limit: more than MaxEdges within WindowCycles masks the line for CooldownCycles,
+ * in EXTI_EVENT_TIMESTAMP() ticks (DWT cycles by default)*/
+typedef struct
+{
+	uint16_t MaxEdges;			/*0 to remove the limit*/
+	uint32_t WindowCycles;
+	uint32_t CooldownCycles;
+
+}EXTI_StormLimit_t;
+
+
+/*A line counters*/
+typedef struct
+{
+	uint32_t Fired;				/*Edges dispatched (callback, queued or captured)*/
+	uint32_t Dropped;			/*Edges over the limit, the edges while masked count as one at the re-arm*/
+	uint32_t Masked;			/*Times the line was masked by the storm guard*/
+
+}EXTI_LineStats_t;
+
+
 										/******************		Interfacing Enums		****************/
 typedef struct
 {
@@ -75,6 +142,8 @@ typedef struct
 	EXTI_IntState_t InitStat;
 	EXTI_TrigEdge_t TrigType;
 	void (*callBackFunc)(void);
+	void (*callBackCtxFunc)(void *Copy_pContext);	/*Optional, used only when callBackFunc is NULL*/
+	void *Context;									/*Passed back to callBackCtxFunc*/
 
 }EXTI_Configs_t;
 
@@ -87,6 +156,8 @@ typedef struct
  * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
  * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
  * 								-  SYSCFG must be configured first
+ * 								-  callBackFunc is used when not NULL, callBackCtxFunc and Context are only read
+ * 								   when callBackFunc is NULL so a ctx callback needs callBackFunc set to NULL
  * 	Side effects:               No side effects
  * 	Post Conditions:            The EXTI line is configured and ready to be used
  * 	Synch/Asynch:               Synch.
@@ -155,6 +226,24 @@ EXTI_ErrorStates_t EXTI_SetCallBackFunc(EXTI_ExtIntLine_t Copy_u8InterruptLine,
 
 
 
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set a callback receiving a context, e.g. a driver object
+ * 								serving many lines gets its instance back with no lookup
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- void (*Copy_pcallBackCtxFunc)(void *): ptr to the callback func
+ * 								- void *Copy_pContext: passed as is to the callback, may be NULL
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
+ * 	Side effects:               Replaces the callback set by EXTI_SetCallBackFunc on the same line
+ * 	Post Conditions:            The callback & its context are set
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetCallBackCtxFunc(EXTI_ExtIntLine_t Copy_u8InterruptLine, void (*Copy_pcallBackCtxFunc)(void *Copy_pContext), void *Copy_pContext);
+
+
+
+
 
 /**************************************************************************************************************
  * 	Decription:                 This Function is used to clear the EXTI pending flag
@@ -194,4 +283,363 @@ EXTI_ErrorStates_t EXTI_ReadPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine,
 
 
 
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to select how a raised line is handled: its callback invoked
+ * 								inside the ISR, or an event {line, edge, timestamp} queued for EXTI_ProcessEvents()
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_LineMode_t Copy_u8LineMode: EXTI_MODE_CALLBACK, EXTI_MODE_DEFERRED, EXTI_MODE_CAPTURE or EXTI_MODE_COUNTER
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
+ * 								-  The IRQs of the deferred lines must share the same NVIC preemption priority
+ * 								   (the queue has a single producer: the ISRs must not preempt each other)
+ * 	Side effects:               Selecting the capture mode clears the line captures, the counter mode its count
+ * 	Post Conditions:            The line mode is set
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetLineMode(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_LineMode_t Copy_u8LineMode);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to pop the oldest deferred event
+ * 	Parameters:                 - EXTI_Event_t *Copy_pEvent: ptr to receive the event
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_QueueEmpty if there is no event
+ * 	Preconditions:              -  Called from a single context (the main loop), the only consumer of the queue
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The event is removed from the queue
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_PopEvent(EXTI_Event_t *Copy_pEvent);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to drain the deferred events, invoking the callback of each
+ * 								event line in the order they were raised
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: the number of events processed
+ * 	Preconditions:              -  Called from a single context (the main loop), the only consumer of the queue
+ * 	Side effects:               Events raised while draining are processed in the same call
+ * 	Post Conditions:            The queue is empty
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+uint32_t EXTI_ProcessEvents(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the number of events dropped because the queue was full
+ * 	Parameters:                 - uint32_t *Copy_pu32Overflows: ptr to receive the count since the start up
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The count is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetEventOverflows(uint32_t *Copy_pu32Overflows);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the period of the signal on a capture line: the time between
+ * 								the last edge and the previous edge of the same direction
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32Period: ptr to receive the period
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if no 2 edges of the same direction are buffered
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The period is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetPeriod(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Period);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the width of the last pulse on a capture line: the time between
+ * 								the last edge and the previous one, e.g. a high pulse if the last edge is falling
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32Width: ptr to receive the width
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if the last 2 edges aren't of opposite directions
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE and triggers on both edges (EXTI_OnChange)
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The pulse width is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetPulseWidth(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Width);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edge rate of a capture line as the mean time between
+ * 								consecutive edges over the buffered captures (edges/s = 1e9 / ns)
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32EdgeInterval: ptr to receive the mean time per edge
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if less than 2 edges are buffered
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The mean edge interval is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetEdgeRate(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32EdgeInterval);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to drop the buffered captures of a line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line has no captures
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ClearCaptures(EXTI_ExtIntLine_t Copy_u8InterruptLine);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable the event request of the EXTI line: its edges wake the
+ * 								core from WFE with no interrupt entry
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the line trigger edge first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI event is enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_EnableEvent(EXTI_ExtIntLine_t Copy_u8InterruptLine);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to disable the event request of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI event is disabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_DisableEvent(EXTI_ExtIntLine_t Copy_u8InterruptLine);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to sleep (WFE) until an edge of the EXTI line, the edge is confirmed
+ * 								by the line pending flag or by the pin level (GPIO lines) after each wakeup
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t Copy_u32TimeoutCycles: DWT cycles to wait at most, 0 waits forever
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_Timeout if no edge came in time
+ * 	Preconditions:              -  EXTI_EnableEvent() is called for the line, its interrupt (IMR) disabled
+ * 								-  DWT_Init() is called if a timeout is given. The timeout is checked on each wakeup, so
+ * 								   a periodic interrupt (e.g. SysTick) must be running to end a wait with no edge
+ * 	Side effects:               Clears the line pending flag
+ * 	Post Conditions:            An edge came or the timeout elapsed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_WaitForEdge(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t Copy_u32TimeoutCycles);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to raise the EXTI line from software (SWIER), its IRQ runs as
+ * 								for a hardware edge
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line interrupt is enabled (EXTI_EnableInterrupt) for the pending flag to be set
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line is pending, the SWIER bit is cleared with the pending flag
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_TriggerSoftware(EXTI_ExtIntLine_t Copy_u8InterruptLine);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the trigger edges of several lines at once, RTSR & FTSR
+ * 								are written once each and the lines stale pending flags are cleared
+ * 	Parameters:                 - uint32_t Copy_u32LinesMask: the lines to be set, bit n for line n
+ * 								- uint32_t Copy_u32RisingMask: the lines triggering on the rising edge
+ * 								- uint32_t Copy_u32FallingMask: the lines triggering on the falling edge
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The rising & falling masks are within the lines mask
+ * 	Side effects:               The other lines are left untouched
+ * 	Post Conditions:            The lines edges are set
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetTrigEdgeLines(uint32_t Copy_u32LinesMask, uint32_t Copy_u32RisingMask, uint32_t Copy_u32FallingMask);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable the interrupt of several lines, each IMR bit is set by
+ * 								its own bit-band store so a line masked by the storm guard from an ISR meanwhile stays masked
+ * 	Parameters:                 - uint32_t Copy_u32LinesMask: the lines to be enabled, bit n for line n
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The lines are set (EXTI_Init or EXTI_SetTrigEdgeLines)
+ * 	Side effects:               The lines masked by the storm guard are skipped, EXTI_StormTick() re-arms them
+ * 	Post Conditions:            The lines are enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_EnableInterruptLines(uint32_t Copy_u32LinesMask);
+
+
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the storm limit of the EXTI line: once it gets more edges
+ * 								than the limit within the window, its interrupt is masked (IMR) from its ISR, the storm
+ * 								callback is notified and the line is re-armed by EXTI_StormTick() after the cooldown
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- const EXTI_StormLimit_t *Copy_pLimit: the limit, MaxEdges 0 to remove it
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_STORM_GUARD is on & the EXTI_EVENT_TIMESTAMP() counter runs (DWT_Init())
+ * 	Side effects:               The line window is restarted
+ * 	Post Conditions:            The line is guarded
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetStormLimit(EXTI_ExtIntLine_t Copy_u8InterruptLine, const EXTI_StormLimit_t *Copy_pLimit);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the func notified from the ISR when a line is masked
+ * 	Parameters:                 - void (*Copy_pStormCallBack)(EXTI_ExtIntLine_t): the func, NULL for none
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               The func runs in the masked line ISR
+ * 	Post Conditions:            The storms are reported
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetStormCallBack(void (*Copy_pStormCallBack)(EXTI_ExtIntLine_t Copy_u8InterruptLine));
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to re-arm the lines masked by the storm guard whose cooldown
+ * 								is over, it's also run by EXTI_ProcessEvents()
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: the number of lines re-armed
+ * 	Preconditions:              -  Called periodically from a single context (the main loop or a timer tick)
+ * 	Side effects:               The edges latched while masked are dropped, counted as one
+ * 	Post Conditions:            The cooled down lines are enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+uint32_t EXTI_StormTick(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the fired, dropped & masked counters of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_LineStats_t *Copy_pStats: ptr to receive the counters
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_STORM_GUARD is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The counters are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetLineStats(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_LineStats_t *Copy_pStats);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the counters of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               An edge serviced while clearing may be lost from the counters
+ * 	Post Conditions:            The counters are zeroed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ClearLineStats(EXTI_ExtIntLine_t Copy_u8InterruptLine);
+
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edges count of the EXTI line in counter mode
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t *Copy_pu32Count: ptr to receive the edges counted since the mode was set, wraps at 2^32
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line is in EXTI_MODE_COUNTER
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The count is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetCount(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t *Copy_pu32Count);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the gate window of the EXTI line frequency: the edges
+ * 								counted over each window are latched by EXTI_FreqTick()
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t Copy_u32GateTicks: the window in EXTI_FreqTick() calls, 0 to stop the measurement
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line is in EXTI_MODE_COUNTER
+ * 	Side effects:               The previous measurement is discarded
+ * 	Post Conditions:            The frequency is valid after a full window
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetGateWindow(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t Copy_u32GateTicks);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is the gate time base of the counter lines, to be called at EXTI_FREQ_TICK_HZ
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called from a single context, e.g. the SysTick ISR
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The lines whose window ended have their gate count latched
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void EXTI_FreqTick(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edges frequency of the EXTI line over its last gate window
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t *Copy_pu32FreqHz: ptr to receive the frequency in Hz, the edges of both
+ * 								  directions are counted on an EXTI_OnChange line
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NoMeasurement before the first full window
+ * 	Preconditions:              -  EXTI_SetGateWindow() is called for the line, the resolution is EXTI_FREQ_TICK_HZ / GateTicks
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The frequency is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetFrequency(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t *Copy_pu32FreqHz);
+
+
+
 #endif
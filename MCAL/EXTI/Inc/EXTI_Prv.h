@@ -10,24 +10,101 @@
 #define EXTI_PRV_H
 
 
-#define INTERRUPT_LINES_NUM		15U
+#define INTERRUPT_LINES_NUM		22U				/*Last line number*/
+#define GPIO_INTERRUPT_LINES_NUM	15U				/*Last line mapped to the GPIO pins*/
+#define EXTI_VALID_LINES_MASK		0x0077FFFFUL	/*Lines 0~22, 19 is reserved*/
+
+#define EXTI_IS_VALID_LINE(LINE)	(((LINE) <= INTERRUPT_LINES_NUM) && ((EXTI_VALID_LINES_MASK >> (LINE)) & 1u))
 #define NULL ( (void *) 0)
 
 
-/*For flag states checking*/
-#define EXTI5_FLAG		(1 & ((EXTI -> PR) >> 5))
-#define EXTI6_FLAG  	(1 & ((EXTI -> PR) >> 6))
-#define EXTI7_FLAG  	(1 & ((EXTI -> PR) >> 7))
-#define EXTI8_FLAG  	(1 & ((EXTI -> PR) >> 8))
-#define EXTI9_FLAG  	(1 & ((EXTI -> PR) >> 9))
-#define EXTI10_FLAG  	(1 & ((EXTI -> PR) >> 10))
-#define EXTI11_FLAG  	(1 & ((EXTI -> PR) >> 11))
-#define EXTI12_FLAG  	(1 & ((EXTI -> PR) >> 12))
-#define EXTI13_FLAG  	(1 & ((EXTI -> PR) >> 13))
-#define EXTI14_FLAG  	(1 & ((EXTI -> PR) >> 14))
-#define EXTI15_FLAG  	(1 & ((EXTI -> PR) >> 15))
-
-#define FLAG_RAISED		1u
+/*Lines sharing an IRQ, serviced from a single PR read*/
+#define EXTI9_5_LINES_MASK		0x000003E0UL
+#define EXTI15_10_LINES_MASK	0x0000FC00UL
+
+#define EXTI_WORD_MSB			31u
+
+
+
+/*Deferred events queue*/
+#if (EXTI_EVENT_QUEUE_SIZE == 0u) || ((EXTI_EVENT_QUEUE_SIZE & (EXTI_EVENT_QUEUE_SIZE - 1u)) != 0u)
+#error "EXTI_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+#define EXTI_EVENT_QUEUE_MASK	(EXTI_EVENT_QUEUE_SIZE - 1u)
+
+
+/*Edges capture*/
+#if (EXTI_CAPTURE_BUFFER_SIZE < 2u) || (EXTI_CAPTURE_BUFFER_SIZE > 32u) || ((EXTI_CAPTURE_BUFFER_SIZE & (EXTI_CAPTURE_BUFFER_SIZE - 1u)) != 0u)
+#error "EXTI_CAPTURE_BUFFER_SIZE must be a power of 2 between 2 and 32"
+#endif
+
+#define EXTI_CAPTURE_BUFFER_MASK	(EXTI_CAPTURE_BUFFER_SIZE - 1u)
+
+/*Timestamp & edge (1 for rising) of the capture number INDEX (free running)*/
+#define EXTI_CAPTURE_STAMP(CAPTURE, INDEX)		((CAPTURE).Stamps[(INDEX) & EXTI_CAPTURE_BUFFER_MASK])
+#define EXTI_CAPTURE_EDGE(CAPTURE, INDEX)		(1 & ((CAPTURE).Edges >> ((INDEX) & EXTI_CAPTURE_BUFFER_MASK)))
+
+
+/*Pin level sampling of the line source, for the edge of the on change lines*/
+#define EXTI_EXTICR_LINES_NUM	4u
+#define EXTI_EXTICR_FIELD_WIDTH	4u
+#define EXTI_EXTICR_FIELD_MASK	0xFu
+#define EXTI_GPIO_PORT_SIZE		0x400UL
+
+
+
+/*A line callback & the context passed back to it*/
+typedef struct
+{
+	void (*Func)(void *Copy_pContext);
+	void *Context;
+
+}EXTI_CallBack_t;
+
+
+
+/*The last edges of a line in capture mode: ring of timestamps indexed by Count (free running),
+ * the edge of each slot is a bit of Edges, 1 for rising*/
+typedef struct
+{
+	uint32_t Stamps[EXTI_CAPTURE_BUFFER_SIZE];
+	uint32_t Edges;
+	volatile uint32_t Count;
+
+}EXTI_Capture_t;
+
+
+
+/*The storm guard state & counters of a line: the window & mask fields are written by the line ISR,
+ * the mask is released by EXTI_StormTick() only while the line is masked so they never race*/
+typedef struct
+{
+	uint32_t WindowCycles;				/*0 with MaxEdges 0: no limit*/
+	uint32_t CooldownCycles;
+	uint32_t WindowStart;
+	uint32_t MaskedAt;
+	uint16_t MaxEdges;
+	uint16_t WindowCount;
+	volatile uint8_t IsMasked;
+	volatile uint32_t Fired;
+	volatile uint32_t Dropped;
+	volatile uint32_t Masked;
+
+}EXTI_Storm_t;
+
+
+
+/*The frequency gate of a line in counter mode: the count delta over GateTicks ticks, written by EXTI_FreqTick() only*/
+typedef struct
+{
+	uint32_t GateTicks;
+	uint32_t TicksLeft;
+	uint32_t LastCount;
+	volatile uint32_t GateCount;
+	volatile uint8_t IsValid;				/*A full gate is measured*/
+
+}EXTI_Gate_t;
 
 
 
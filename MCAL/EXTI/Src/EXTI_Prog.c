@@ -9,10 +9,20 @@
 #include "stdint.h"
 
 #include "Stm32F446xx.h"
+#include "CortexM4_Core.h"
+#include "MCAL_Config.h"
 
+#include "DWT_Interface.h"
+
+#include "EXTI_Config.h"
 #include "EXTI_Prv.h"
 #include "EXTI_Interface.h"
 
+#if EXTI_PROFILING == EXTI_PROFILING_ON
+#include "NVIC_Interface.h"
+#include "IRQPROF_Interface.h"
+#endif
+
 
 /*
  *
@@ -22,6 +32,182 @@
 static void (* CallBack_FuncPtrs[INTERRUPT_LINES_NUM + 1])(void) = {NULL};
 
 
+/*
+ *
+ * @brief: The callbacks invoked by the IRQs, a void(void) callback is invoked through EXTI_vidVoidCallBack
+ * 			with its CallBack_FuncPtrs entry as context
+ *
+ * */
+static EXTI_CallBack_t EXTI_CallBacks[INTERRUPT_LINES_NUM + 1] = {{NULL, NULL}};
+
+
+
+/*
+ *
+ * @brief: Per line mode & the deferred events queue: single producer (the EXTI ISRs), single consumer (the main loop).
+ * 			Head is only written by the producer & Tail only by the consumer, both free running, so no lock is needed
+ *
+ * */
+static uint8_t EXTI_LineModes[INTERRUPT_LINES_NUM + 1] = {EXTI_MODE_CALLBACK};
+
+static EXTI_Event_t EXTI_EventsQueue[EXTI_EVENT_QUEUE_SIZE];
+static volatile uint32_t EXTI_u32QueueHead = 0;
+static volatile uint32_t EXTI_u32QueueTail = 0;
+static volatile uint32_t EXTI_u32QueueOverflows = 0;
+
+
+/*
+ *
+ * @brief: The edges captures of the lines in capture mode, written by the ISRs only
+ *
+ * */
+static EXTI_Capture_t EXTI_Captures[INTERRUPT_LINES_NUM + 1];
+
+
+
+/*
+ *
+ * @brief: The storm guard state & counters of the lines and the func notified when a line is masked
+ *
+ * */
+static EXTI_Storm_t EXTI_Storms[INTERRUPT_LINES_NUM + 1];
+
+static void (*EXTI_pStormCallBack)(EXTI_ExtIntLine_t Copy_u8InterruptLine) = NULL;
+
+
+
+/*
+ *
+ * @brief: The edges counts of the lines in counter mode (written by the ISRs only), their frequency gates
+ * 			and the lines being gated (written by EXTI_SetGateWindow() only)
+ *
+ * */
+static volatile uint32_t EXTI_Counts[INTERRUPT_LINES_NUM + 1];
+
+static EXTI_Gate_t EXTI_Gates[INTERRUPT_LINES_NUM + 1];
+static volatile uint32_t EXTI_u32GatedLines = 0;
+
+
+
+static void EXTI_vidVoidCallBack(void *Copy_pContext)
+{
+	(*(void (**)(void))Copy_pContext)();
+}
+
+
+static void EXTI_vidSetVoidCallBack(EXTI_ExtIntLine_t Copy_u8InterruptLine, void (*Copy_pcallBackFunc)(void))
+{
+	CallBack_FuncPtrs[Copy_u8InterruptLine] = Copy_pcallBackFunc;
+	EXTI_CallBacks[Copy_u8InterruptLine].Func = EXTI_vidVoidCallBack;
+	EXTI_CallBacks[Copy_u8InterruptLine].Context = (void *)&CallBack_FuncPtrs[Copy_u8InterruptLine];
+}
+
+
+
+/*
+ *
+ * @brief: Level of the pin a GPIO line is routed to by SYSCFG EXTICR
+ *
+ * */
+static uint8_t EXTI_u8ReadLinePin(uint8_t Copy_u8Line)
+{
+	uint8_t Local_u8Port = ((SYSCFG -> EXTICR[Copy_u8Line / EXTI_EXTICR_LINES_NUM]) >> ((Copy_u8Line % EXTI_EXTICR_LINES_NUM) * EXTI_EXTICR_FIELD_WIDTH)) & EXTI_EXTICR_FIELD_MASK;
+	GPIO_RegDef_t * Local_pGPIOx = (GPIO_RegDef_t *)(GPIOA_BASE_ADDRESS + (Local_u8Port * EXTI_GPIO_PORT_SIZE));
+
+	return (1 & ((Local_pGPIOx -> IDR) >> Copy_u8Line));
+}
+
+
+
+/*
+ *
+ * @brief: Copying the captures of a line consistently: the copy is retried if an ISR added an edge meanwhile
+ *
+ * */
+static void EXTI_vidReadCaptures(uint8_t Copy_u8Line, EXTI_Capture_t *Copy_pCapture)
+{
+	uint32_t Local_u32Count;
+	uint8_t Local_u8Slot;
+
+	do
+	{
+		Local_u32Count = EXTI_Captures[Copy_u8Line].Count;
+		__asm__ volatile ("" ::: "memory");
+
+		for(Local_u8Slot = 0; Local_u8Slot < EXTI_CAPTURE_BUFFER_SIZE; Local_u8Slot++)
+		{
+			Copy_pCapture -> Stamps[Local_u8Slot] = EXTI_Captures[Copy_u8Line].Stamps[Local_u8Slot];
+		}
+
+		Copy_pCapture -> Edges = EXTI_Captures[Copy_u8Line].Edges;
+		__asm__ volatile ("" ::: "memory");
+
+	}while(Local_u32Count != EXTI_Captures[Copy_u8Line].Count);
+
+	Copy_pCapture -> Count = Local_u32Count;
+}
+
+
+/*
+ *
+ * @brief: Checking the params common to the capture getters
+ *
+ * */
+static EXTI_ErrorStates_t EXTI_u8CheckCaptureParams(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Time)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+#if MCAL_PARAM_CHECKS == MCAL_CHECKS_OFF
+	/*Only the NULL check is left*/
+	(void)Copy_u8InterruptLine;
+	(void)Copy_u8Unit;
+#endif
+
+	if(Copy_pu32Time == NULL)
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
+
+	else if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if(!MCAL_PARAM_VALID((Copy_u8Unit == EXTI_UNIT_CYCLES) || (Copy_u8Unit == EXTI_UNIT_NS)))
+	{
+		Local_u8ErrorState = EXTI_InvalidTimeUnit;
+	}
+
+	else
+	{
+		/*Params are valid*/
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+static EXTI_ErrorStates_t EXTI_u8ConvertCycles(uint32_t Copy_u32Cycles, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Time)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(Copy_u8Unit == EXTI_UNIT_NS)
+	{
+		if(DWT_CyclesToNs(Copy_u32Cycles, Copy_pu32Time) != DWT_Exit_OK)
+		{
+			Local_u8ErrorState = EXTI_InvalidTimeUnit;
+		}
+	}
+
+	else
+	{
+		*Copy_pu32Time = Copy_u32Cycles;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
 
 
 
@@ -31,6 +217,8 @@ static void (* CallBack_FuncPtrs[INTERRUPT_LINES_NUM + 1])(void) = {NULL};
  * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
  * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
  * 								-  SYSCFG must be configured first
+ * 								-  callBackFunc is used when not NULL, callBackCtxFunc and Context are only read
+ * 								   when callBackFunc is NULL so a ctx callback needs callBackFunc set to NULL
  * 	Side effects:               No side effects
  * 	Post Conditions:            The EXTI line is configured and ready to be used
  * 	Synch/Asynch:               Synch.
@@ -41,10 +229,10 @@ EXTI_ErrorStates_t EXTI_Init(EXTI_Configs_t *Copy_pExtIntConfigs)
 
 	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_pExtIntConfigs -> IntLine >= 0) && (Copy_pExtIntConfigs -> IntLine <= 15))
+	if(Copy_pExtIntConfigs != NULL)
 	{
 
-		if(Copy_pExtIntConfigs != NULL)
+		if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_pExtIntConfigs -> IntLine)))
 		{
 
 			/*edge Detection type setting*/
@@ -52,22 +240,22 @@ EXTI_ErrorStates_t EXTI_Init(EXTI_Configs_t *Copy_pExtIntConfigs)
 			{
 				case EXTI_RisingEdge:
 				{
-					EXTI -> RTSR |=  (1 << (Copy_pExtIntConfigs -> IntLine));
-					EXTI -> FTSR &= ~(1 << (Copy_pExtIntConfigs -> IntLine));
+					BITBAND_PERIPH(EXTI -> RTSR, (Copy_pExtIntConfigs -> IntLine)) = 1;
+					BITBAND_PERIPH(EXTI -> FTSR, (Copy_pExtIntConfigs -> IntLine)) = 0;
 					break;
 				}
 
 				case EXTI_FallingEdge:
 				{
-					EXTI -> RTSR &=  ~(1 << (Copy_pExtIntConfigs -> IntLine));
-					EXTI -> FTSR |=   (1 << (Copy_pExtIntConfigs -> IntLine));
+					BITBAND_PERIPH(EXTI -> RTSR, (Copy_pExtIntConfigs -> IntLine)) = 0;
+					BITBAND_PERIPH(EXTI -> FTSR, (Copy_pExtIntConfigs -> IntLine)) = 1;
 					break;
 				}
 
 				case EXTI_OnChange:
 				{
-					EXTI -> RTSR |=   (1 << (Copy_pExtIntConfigs -> IntLine));
-					EXTI -> FTSR |=   (1 << (Copy_pExtIntConfigs -> IntLine));
+					BITBAND_PERIPH(EXTI -> RTSR, (Copy_pExtIntConfigs -> IntLine)) = 1;
+					BITBAND_PERIPH(EXTI -> FTSR, (Copy_pExtIntConfigs -> IntLine)) = 1;
 					break;
 				}
 
@@ -78,8 +266,8 @@ EXTI_ErrorStates_t EXTI_Init(EXTI_Configs_t *Copy_pExtIntConfigs)
 			/*Interrupt initial state setting*/
 			switch(Copy_pExtIntConfigs -> InitStat)
 			{
-				case EXTI_ENABLED:  EXTI -> IMR |=  (1 << (Copy_pExtIntConfigs -> IntLine)); break;
-				case EXTI_DISABLED: EXTI -> IMR &= ~(1 << (Copy_pExtIntConfigs -> IntLine)); break;
+				case EXTI_ENABLED:  BITBAND_PERIPH(EXTI -> IMR, (Copy_pExtIntConfigs -> IntLine)) = 1; break;
+				case EXTI_DISABLED: BITBAND_PERIPH(EXTI -> IMR, (Copy_pExtIntConfigs -> IntLine)) = 0; break;
 				default: Local_u8ErrorState = EXTI_InvalidInitState; break;
 
 			}
@@ -87,10 +275,16 @@ EXTI_ErrorStates_t EXTI_Init(EXTI_Configs_t *Copy_pExtIntConfigs)
 
 
 
-			/*call back func setting*/
+			/*call back func setting, the void one first so callers that only fill callBackFunc keep working*/
 			if((Copy_pExtIntConfigs -> callBackFunc) != NULL)
 			{
-				CallBack_FuncPtrs[(Copy_pExtIntConfigs -> IntLine)] = Copy_pExtIntConfigs -> callBackFunc;
+				EXTI_vidSetVoidCallBack((Copy_pExtIntConfigs -> IntLine), (Copy_pExtIntConfigs -> callBackFunc));
+			}
+
+			else if((Copy_pExtIntConfigs -> callBackCtxFunc) != NULL)
+			{
+				EXTI_CallBacks[(Copy_pExtIntConfigs -> IntLine)].Func = Copy_pExtIntConfigs -> callBackCtxFunc;
+				EXTI_CallBacks[(Copy_pExtIntConfigs -> IntLine)].Context = Copy_pExtIntConfigs -> Context;
 			}
 
 			else
@@ -102,14 +296,14 @@ EXTI_ErrorStates_t EXTI_Init(EXTI_Configs_t *Copy_pExtIntConfigs)
 
 		else
 		{
-			Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+			Local_u8ErrorState = EXTI_InvalidLineNumber;
 		}
 
 	}
 
 	else
 	{
-		Local_u8ErrorState = EXTI_InvalidLineNumber;
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
 	}
 
 
@@ -133,9 +327,9 @@ EXTI_ErrorStates_t EXTI_EnableInterrupt(EXTI_ExtIntLine_t Copy_u8InterruptLine)
 {
 	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
-		EXTI -> IMR |= (1 << Copy_u8InterruptLine);
+		BITBAND_PERIPH(EXTI -> IMR, Copy_u8InterruptLine) = 1;
 	}
 
 	else
@@ -162,9 +356,12 @@ EXTI_ErrorStates_t EXTI_DisableInterrupt(EXTI_ExtIntLine_t Copy_u8InterruptLine)
 {
 	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
-		EXTI -> IMR &= ~(1 << Copy_u8InterruptLine);
+		BITBAND_PERIPH(EXTI -> IMR, Copy_u8InterruptLine) = 0;
+
+		/*Disabled by the app, not to be re-armed by the storm guard*/
+		EXTI_Storms[Copy_u8InterruptLine].IsMasked = 0;
 	}
 
 	else
@@ -192,28 +389,28 @@ EXTI_ErrorStates_t EXTI_SetTrigEdge(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI
 {
 	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
 		switch(Copy_u8TrigEdge)
 		{
 			case EXTI_RisingEdge:
 			{
-				EXTI -> RTSR |=  (1 << Copy_u8InterruptLine);
-				EXTI -> FTSR &= ~(1 << Copy_u8InterruptLine);
+				BITBAND_PERIPH(EXTI -> RTSR, Copy_u8InterruptLine) = 1;
+				BITBAND_PERIPH(EXTI -> FTSR, Copy_u8InterruptLine) = 0;
 				break;
 			}
 
 			case EXTI_FallingEdge:
 			{
-				EXTI -> RTSR &=  ~(1 << Copy_u8InterruptLine);
-				EXTI -> FTSR |=   (1 << Copy_u8InterruptLine);
+				BITBAND_PERIPH(EXTI -> RTSR, Copy_u8InterruptLine) = 0;
+				BITBAND_PERIPH(EXTI -> FTSR, Copy_u8InterruptLine) = 1;
 				break;
 			}
 
 			case EXTI_OnChange:
 			{
-				EXTI -> RTSR |=   (1 << Copy_u8InterruptLine);
-				EXTI -> FTSR |=   (1 << Copy_u8InterruptLine);
+				BITBAND_PERIPH(EXTI -> RTSR, Copy_u8InterruptLine) = 1;
+				BITBAND_PERIPH(EXTI -> FTSR, Copy_u8InterruptLine) = 1;
 				break;
 			}
 
@@ -251,11 +448,11 @@ EXTI_ErrorStates_t EXTI_SetCallBackFunc(EXTI_ExtIntLine_t Copy_u8InterruptLine,
 
 	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
 		if(Copy_pcallBackFunc != NULL)
 		{
-			CallBack_FuncPtrs[Copy_u8InterruptLine] = Copy_pcallBackFunc;
+			EXTI_vidSetVoidCallBack(Copy_u8InterruptLine, Copy_pcallBackFunc);
 		}
 
 		else
@@ -281,22 +478,33 @@ EXTI_ErrorStates_t EXTI_SetCallBackFunc(EXTI_ExtIntLine_t Copy_u8InterruptLine,
 
 
 /**************************************************************************************************************
- * 	Decription:                 This Function is used to clear the EXTI pending flag
+ * 	Decription:                 This Function is used to set a callback receiving a context
  * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- void (*Copy_pcallBackCtxFunc)(void *): ptr to the callback func
+ * 								- void *Copy_pContext: passed as is to the callback, may be NULL
  * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
  * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
- * 	Side effects:               No side effects
- * 	Post Conditions:            The EXTI pending flag is cleared
+ * 	Side effects:               Replaces the callback set by EXTI_SetCallBackFunc on the same line
+ * 	Post Conditions:            The callback & its context are set
  * 	Synch/Asynch:               Synch.
  * 	Reentrant/NonReenterant:    Non
  *************************************************************************************************************/
-EXTI_ErrorStates_t EXTI_ClearPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+EXTI_ErrorStates_t EXTI_SetCallBackCtxFunc(EXTI_ExtIntLine_t Copy_u8InterruptLine, void (*Copy_pcallBackCtxFunc)(void *Copy_pContext), void *Copy_pContext)
 {
-	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
-		EXTI -> PR = 1 << Copy_u8InterruptLine;
+		if(Copy_pcallBackCtxFunc != NULL)
+		{
+			EXTI_CallBacks[Copy_u8InterruptLine].Func = Copy_pcallBackCtxFunc;
+			EXTI_CallBacks[Copy_u8InterruptLine].Context = Copy_pContext;
+		}
+
+		else
+		{
+			Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+		}
 	}
 
 	else
@@ -305,35 +513,55 @@ EXTI_ErrorStates_t EXTI_ClearPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine)
 	}
 
 	return Local_u8ErrorState;
-
 }
 
 
+
+
 /**************************************************************************************************************
- * 	Description:                 This Function is used to clear the EXTI pending flag
+ * 	Decription:                 This Function is used to select how a raised line is handled
  * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
- * 								- uint8_t* Copy_pPendingFlagState: a ptr to unit8_t variable that will be derfernced with the flag state
+ * 								- EXTI_LineMode_t Copy_u8LineMode: EXTI_MODE_CALLBACK, EXTI_MODE_DEFERRED, EXTI_MODE_CAPTURE or EXTI_MODE_COUNTER
  * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
  * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
- * 	Side effects:               No side effects
- * 	Post Conditions:            The EXTI pending flag state is retrieved
+ * 								-  The IRQs of the deferred lines must share the same NVIC preemption priority
+ * 	Side effects:               Selecting the capture mode clears the line captures, the counter mode its count
+ * 	Post Conditions:            The line mode is set
  * 	Synch/Asynch:               Synch.
  * 	Reentrant/NonReenterant:    Non
  *************************************************************************************************************/
-EXTI_ErrorStates_t EXTI_ReadPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint8_t* Copy_pPendingFlagState)
+EXTI_ErrorStates_t EXTI_SetLineMode(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_LineMode_t Copy_u8LineMode)
 {
-	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
 
-	if((Copy_u8InterruptLine >= 0) && (Copy_u8InterruptLine <= 15))
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
-		if(Copy_pPendingFlagState != NULL)
+		if(MCAL_PARAM_VALID((Copy_u8LineMode >= EXTI_MODE_CALLBACK) && (Copy_u8LineMode <= EXTI_MODE_COUNTER)))
 		{
-			*Copy_pPendingFlagState = (1 & ((EXTI -> PR) >> Copy_u8InterruptLine));
+			if(Copy_u8LineMode == EXTI_MODE_CAPTURE)
+			{
+				EXTI_Captures[Copy_u8InterruptLine].Count = 0;
+				EXTI_Captures[Copy_u8InterruptLine].Edges = 0;
+			}
+
+			else if(Copy_u8LineMode == EXTI_MODE_COUNTER)
+			{
+				EXTI_Counts[Copy_u8InterruptLine] = 0;
+			}
+
+			if(Copy_u8LineMode != EXTI_MODE_COUNTER)
+			{
+				/*Leaving the counter mode stops its frequency gate*/
+				EXTI_u32GatedLines &= ~(1UL << Copy_u8InterruptLine);
+				EXTI_Gates[Copy_u8InterruptLine].IsValid = 0;
+			}
+
+			EXTI_LineModes[Copy_u8InterruptLine] = Copy_u8LineMode;
 		}
 
 		else
 		{
-			Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+			Local_u8ErrorState = EXTI_InvalidLineMode;
 		}
 	}
 
@@ -347,183 +575,1341 @@ EXTI_ErrorStates_t EXTI_ReadPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine,
 
 
 
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to pop the oldest deferred event
+ * 	Parameters:                 - EXTI_Event_t *Copy_pEvent: ptr to receive the event
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_QueueEmpty if there is no event
+ * 	Preconditions:              -  Called from a single context (the main loop), the only consumer of the queue
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The event is removed from the queue
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_PopEvent(EXTI_Event_t *Copy_pEvent)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
 
+	if(Copy_pEvent != NULL)
+	{
+		uint32_t Local_u32Tail = EXTI_u32QueueTail;
 
-/*
- *
- * @brief: Imblementing the IRQs
- *
- * */
-void EXTI0_IRQHandler()
-{
-	/*clearing the pending flag*/
-	EXTI -> PR = (1 << EXTI0);
+		if(Local_u32Tail != EXTI_u32QueueHead)
+		{
+			/*The event must be read after Head & before the slot is released*/
+			__asm__ volatile ("" ::: "memory");
+			*Copy_pEvent = EXTI_EventsQueue[Local_u32Tail & EXTI_EVENT_QUEUE_MASK];
+			__asm__ volatile ("" ::: "memory");
+			EXTI_u32QueueTail = Local_u32Tail + 1u;
+		}
 
-	/*Invoking the callback func*/
-	CallBack_FuncPtrs[EXTI0]();
+		else
+		{
+			Local_u8ErrorState = EXTI_QueueEmpty;
+		}
+	}
 
+	else
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
 
+	return Local_u8ErrorState;
 }
 
 
 
-void EXTI1_IRQHandler()
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to drain the deferred events, invoking their lines callbacks
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: the number of events processed
+ * 	Preconditions:              -  Called from a single context (the main loop), the only consumer of the queue
+ * 	Side effects:               Events raised while draining are processed in the same call
+ * 	Post Conditions:            The queue is empty
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+uint32_t EXTI_ProcessEvents(void)
 {
-	/*clearing the pending flag*/
-	EXTI->PR = (1 << EXTI1);
+	uint32_t Local_u32Processed = 0;
+	EXTI_Event_t Local_Event;
 
-	/*Invoking the callback func*/
-	CallBack_FuncPtrs[EXTI1]();
+#if EXTI_STORM_GUARD == EXTI_STORM_GUARD_ON
+	EXTI_StormTick();
+#endif
+
+	while(EXTI_PopEvent(&Local_Event) == EXTI_Exit_OK)
+	{
+		if(EXTI_CallBacks[Local_Event.Line].Func != NULL)
+		{
+			EXTI_CallBacks[Local_Event.Line].Func(EXTI_CallBacks[Local_Event.Line].Context);
+		}
 
+		Local_u32Processed++;
+	}
 
+	return Local_u32Processed;
 }
 
 
 
-void EXTI2_IRQHandler()
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the number of events dropped because the queue was full
+ * 	Parameters:                 - uint32_t *Copy_pu32Overflows: ptr to receive the count since the start up
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The count is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetEventOverflows(uint32_t *Copy_pu32Overflows)
 {
-	/*clearing the pending flag*/
-	EXTI->PR = (1 << EXTI2);
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
 
-	/*Invoking the callback func*/
-	CallBack_FuncPtrs[EXTI2]();
+	if(Copy_pu32Overflows != NULL)
+	{
+		*Copy_pu32Overflows = EXTI_u32QueueOverflows;
+	}
 
+	else
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
 
+	return Local_u8ErrorState;
 }
 
 
 
-void EXTI3_IRQHandler()
-{
-	/*clearing the pending flag*/
-	EXTI->PR = (1 << EXTI3);
 
-	/*Invoking the callback func*/
-	CallBack_FuncPtrs[EXTI3]();
-
-
-}
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the period of the signal on a capture line: the time between
+ * 								the last edge and the previous edge of the same direction
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32Period: ptr to receive the period
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if no 2 edges of the same direction are buffered
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The period is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetPeriod(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Period)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_u8CheckCaptureParams(Copy_u8InterruptLine, Copy_u8Unit, Copy_pu32Period);
 
+	if(Local_u8ErrorState == EXTI_Exit_OK)
+	{
+		EXTI_Capture_t Local_Capture;
+		uint32_t Local_u32Last;
+		uint32_t Local_u32Oldest;
+		uint32_t Local_u32Index;
 
+		EXTI_vidReadCaptures(Copy_u8InterruptLine, &Local_Capture);
+		Local_u8ErrorState = EXTI_NotEnoughCaptures;
 
-void EXTI4_IRQHandler()
-{
-	/*clearing the pending flag*/
-	EXTI->PR = (1 << EXTI4);
+		if(Local_Capture.Count >= 2u)
+		{
+			Local_u32Last = Local_Capture.Count - 1u;
+			Local_u32Oldest = (Local_Capture.Count > EXTI_CAPTURE_BUFFER_SIZE) ? (Local_Capture.Count - EXTI_CAPTURE_BUFFER_SIZE) : 0u;
 
-	/*Invoking the callback func*/
-	CallBack_FuncPtrs[EXTI4]();
+			/*Previous edge of the same direction, the last one is skipped*/
+			for(Local_u32Index = Local_u32Last; Local_u32Index != Local_u32Oldest; )
+			{
+				Local_u32Index--;
 
+				if(EXTI_CAPTURE_EDGE(Local_Capture, Local_u32Index) == EXTI_CAPTURE_EDGE(Local_Capture, Local_u32Last))
+				{
+					Local_u8ErrorState = EXTI_u8ConvertCycles(EXTI_CAPTURE_STAMP(Local_Capture, Local_u32Last) - EXTI_CAPTURE_STAMP(Local_Capture, Local_u32Index),
+															  Copy_u8Unit, Copy_pu32Period);
+					break;
+				}
+			}
+		}
+	}
 
+	return Local_u8ErrorState;
 }
 
 
 
-void EXTI9_5_IRQHandler()
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the width of the last pulse on a capture line: the time between
+ * 								the last edge and the previous one, e.g. a high pulse if the last edge is falling
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32Width: ptr to receive the width
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if the last 2 edges aren't of opposite directions
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE and triggers on both edges (EXTI_OnChange)
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The pulse width is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetPulseWidth(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32Width)
 {
-	if(EXTI5_FLAG == FLAG_RAISED)
-	{
-		/*clearing the pending flag*/
-		EXTI->PR = (1 << EXTI5);
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_u8CheckCaptureParams(Copy_u8InterruptLine, Copy_u8Unit, Copy_pu32Width);
 
-		/*Invoking the callback func*/
-		CallBack_FuncPtrs[EXTI5]();
-	}
-
-	if(EXTI6_FLAG == FLAG_RAISED)
+	if(Local_u8ErrorState == EXTI_Exit_OK)
 	{
+		EXTI_Capture_t Local_Capture;
+		uint32_t Local_u32Last;
 
-		EXTI->PR = (1 << EXTI6);
-		CallBack_FuncPtrs[EXTI6]();
-	}
+		EXTI_vidReadCaptures(Copy_u8InterruptLine, &Local_Capture);
+		Local_u32Last = Local_Capture.Count - 1u;
 
-	if(EXTI7_FLAG == FLAG_RAISED)
-	{
+		if((Local_Capture.Count >= 2u) &&
+		   (EXTI_CAPTURE_EDGE(Local_Capture, Local_u32Last) != EXTI_CAPTURE_EDGE(Local_Capture, Local_u32Last - 1u)))
+		{
+			Local_u8ErrorState = EXTI_u8ConvertCycles(EXTI_CAPTURE_STAMP(Local_Capture, Local_u32Last) - EXTI_CAPTURE_STAMP(Local_Capture, Local_u32Last - 1u),
+													  Copy_u8Unit, Copy_pu32Width);
+		}
+
+		else
+		{
+			Local_u8ErrorState = EXTI_NotEnoughCaptures;
+		}
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edge rate of a capture line as the mean time between
+ * 								consecutive edges over the buffered captures (edges/s = 1e9 / ns)
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_TimeUnit_t Copy_u8Unit: EXTI_UNIT_CYCLES or EXTI_UNIT_NS
+ * 								- uint32_t *Copy_pu32EdgeInterval: ptr to receive the mean time per edge
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NotEnoughCaptures if less than 2 edges are buffered
+ * 	Preconditions:              -  The line is in EXTI_MODE_CAPTURE
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The mean edge interval is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetEdgeRate(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_TimeUnit_t Copy_u8Unit, uint32_t *Copy_pu32EdgeInterval)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_u8CheckCaptureParams(Copy_u8InterruptLine, Copy_u8Unit, Copy_pu32EdgeInterval);
+
+	if(Local_u8ErrorState == EXTI_Exit_OK)
+	{
+		EXTI_Capture_t Local_Capture;
+		uint32_t Local_u32Buffered;
+
+		EXTI_vidReadCaptures(Copy_u8InterruptLine, &Local_Capture);
+		Local_u32Buffered = (Local_Capture.Count > EXTI_CAPTURE_BUFFER_SIZE) ? EXTI_CAPTURE_BUFFER_SIZE : Local_Capture.Count;
+
+		if(Local_u32Buffered >= 2u)
+		{
+			uint32_t Local_u32Span = EXTI_CAPTURE_STAMP(Local_Capture, Local_Capture.Count - 1u) -
+									 EXTI_CAPTURE_STAMP(Local_Capture, Local_Capture.Count - Local_u32Buffered);
+
+			Local_u8ErrorState = EXTI_u8ConvertCycles(Local_u32Span / (Local_u32Buffered - 1u), Copy_u8Unit, Copy_pu32EdgeInterval);
+		}
+
+		else
+		{
+			Local_u8ErrorState = EXTI_NotEnoughCaptures;
+		}
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to drop the buffered captures of a line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line has no captures
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ClearCaptures(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		EXTI_Captures[Copy_u8InterruptLine].Count = 0;
+		EXTI_Captures[Copy_u8InterruptLine].Edges = 0;
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable the event request of the EXTI line: its edges wake the
+ * 								core from WFE with no interrupt entry
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the line trigger edge first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI event is enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_EnableEvent(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		BITBAND_PERIPH(EXTI -> EMR, Copy_u8InterruptLine) = 1;
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to disable the event request of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI event is disabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_DisableEvent(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		BITBAND_PERIPH(EXTI -> EMR, Copy_u8InterruptLine) = 0;
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to sleep (WFE) until an edge of the EXTI line, the edge is confirmed
+ * 								by the line pending flag or by the pin level (GPIO lines) after each wakeup
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t Copy_u32TimeoutCycles: DWT cycles to wait at most, 0 waits forever
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_Timeout if no edge came in time
+ * 	Preconditions:              -  EXTI_EnableEvent() is called for the line, its interrupt (IMR) disabled
+ * 								-  DWT_Init() is called if a timeout is given. The timeout is checked on each wakeup, so
+ * 								   a periodic interrupt (e.g. SysTick) must be running to end a wait with no edge
+ * 	Side effects:               Clears the line pending flag
+ * 	Post Conditions:            An edge came or the timeout elapsed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_WaitForEdge(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t Copy_u32TimeoutCycles)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		uint32_t Local_u32LineMask = (1UL << Copy_u8InterruptLine);
+		uint32_t Local_u32Start = DWT_u32GetCycles();
+		uint8_t Local_u8IsPin = (Copy_u8InterruptLine <= GPIO_INTERRUPT_LINES_NUM);
+		uint8_t Local_u8Rising = (1 & ((EXTI -> RTSR) >> Copy_u8InterruptLine));
+		uint8_t Local_u8Falling = (1 & ((EXTI -> FTSR) >> Copy_u8InterruptLine));
+		uint8_t Local_u8LastLevel = Local_u8IsPin ? EXTI_u8ReadLinePin(Copy_u8InterruptLine) : 0u;
+		uint8_t Local_u8Level;
+		uint8_t Local_u8Waiting = 1;
+
+		/*Dropping a stale event: SEV latches one for sure, WFE consumes it at once. And a stale pending flag*/
+		CORE_SEV();
+		CORE_WFE();
+		EXTI -> PR = Local_u32LineMask;
+
+		while(Local_u8Waiting)
+		{
+			CORE_WFE();
+
+			/*Any event wakes the core: the edge is confirmed by the pending flag or the pin level*/
+			if((EXTI -> PR) & Local_u32LineMask)
+			{
+				EXTI -> PR = Local_u32LineMask;
+				Local_u8Waiting = 0;
+			}
+
+			else if(Local_u8IsPin)
+			{
+				Local_u8Level = EXTI_u8ReadLinePin(Copy_u8InterruptLine);
+
+				if((Local_u8Level != Local_u8LastLevel) && ((Local_u8Level && Local_u8Rising) || (!Local_u8Level && Local_u8Falling)))
+				{
+					Local_u8Waiting = 0;
+				}
+
+				Local_u8LastLevel = Local_u8Level;
+			}
+
+			else
+			{
+				/*Internal line, the pending flag only*/
+			}
+
+			if(Local_u8Waiting && (Copy_u32TimeoutCycles != 0u) && ((DWT_u32GetCycles() - Local_u32Start) >= Copy_u32TimeoutCycles))
+			{
+				Local_u8ErrorState = EXTI_Timeout;
+				Local_u8Waiting = 0;
+			}
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to raise the EXTI line from software (SWIER), its IRQ runs as
+ * 								for a hardware edge
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line interrupt is enabled (EXTI_EnableInterrupt) for the pending flag to be set
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line is pending, the SWIER bit is cleared with the pending flag
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_TriggerSoftware(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		/*Writing 0 has no effect, no read-modify-write needed*/
+		EXTI -> SWIER = (1UL << Copy_u8InterruptLine);
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the trigger edges of several lines at once, RTSR & FTSR
+ * 								are written once each and the lines stale pending flags are cleared
+ * 	Parameters:                 - uint32_t Copy_u32LinesMask: the lines to be set, bit n for line n
+ * 								- uint32_t Copy_u32RisingMask: the lines triggering on the rising edge
+ * 								- uint32_t Copy_u32FallingMask: the lines triggering on the falling edge
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The rising & falling masks are within the lines mask
+ * 	Side effects:               The other lines are left untouched
+ * 	Post Conditions:            The lines edges are set
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetTrigEdgeLines(uint32_t Copy_u32LinesMask, uint32_t Copy_u32RisingMask, uint32_t Copy_u32FallingMask)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(!MCAL_PARAM_VALID((Copy_u32LinesMask & ~EXTI_VALID_LINES_MASK) == 0u))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if(((Copy_u32RisingMask | Copy_u32FallingMask) & ~Copy_u32LinesMask) != 0u)
+	{
+		Local_u8ErrorState = EXTI_InvalidEdgeType;
+	}
+
+	else
+	{
+		EXTI -> RTSR = ((EXTI -> RTSR) & ~Copy_u32LinesMask) | Copy_u32RisingMask;
+		EXTI -> FTSR = ((EXTI -> FTSR) & ~Copy_u32LinesMask) | Copy_u32FallingMask;
+
+		/*Edges latched under the old configs are dropped*/
+		EXTI -> PR = Copy_u32LinesMask;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to enable the interrupt of several lines, each IMR bit is set by
+ * 								its own bit-band store so a line masked by the storm guard from an ISR meanwhile stays masked
+ * 	Parameters:                 - uint32_t Copy_u32LinesMask: the lines to be enabled, bit n for line n
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The lines are set (EXTI_Init or EXTI_SetTrigEdgeLines)
+ * 	Side effects:               The lines masked by the storm guard are skipped, EXTI_StormTick() re-arms them
+ * 	Post Conditions:            The lines are enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_EnableInterruptLines(uint32_t Copy_u32LinesMask)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+	uint8_t Local_u8Line;
+
+	if(MCAL_PARAM_VALID((Copy_u32LinesMask & ~EXTI_VALID_LINES_MASK) == 0u))
+	{
+		/*A plain IMR |= could write back a bit the storm guard cleared from an ISR between its read & its write*/
+		for(Local_u8Line = 0; Local_u8Line <= INTERRUPT_LINES_NUM; Local_u8Line++)
+		{
+			if(((Copy_u32LinesMask >> Local_u8Line) & 1u) && (EXTI_Storms[Local_u8Line].IsMasked == 0u))
+			{
+				BITBAND_PERIPH(EXTI -> IMR, Local_u8Line) = 1;
+
+				/*Masked by the guard between the check & the store: the mask is put back*/
+				if(EXTI_Storms[Local_u8Line].IsMasked)
+				{
+					BITBAND_PERIPH(EXTI -> IMR, Local_u8Line) = 0;
+				}
+			}
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the storm limit of the EXTI line: once it gets more edges
+ * 								than the limit within the window, its interrupt is masked (IMR) from its ISR, the storm
+ * 								callback is notified and the line is re-armed by EXTI_StormTick() after the cooldown
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- const EXTI_StormLimit_t *Copy_pLimit: the limit, MaxEdges 0 to remove it
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_STORM_GUARD is on & the EXTI_EVENT_TIMESTAMP() counter runs (DWT_Init())
+ * 	Side effects:               The line window is restarted
+ * 	Post Conditions:            The line is guarded
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetStormLimit(EXTI_ExtIntLine_t Copy_u8InterruptLine, const EXTI_StormLimit_t *Copy_pLimit)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(Copy_pLimit == NULL)
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
+
+	else if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if((Copy_pLimit -> MaxEdges != 0u) && (Copy_pLimit -> WindowCycles == 0u))
+	{
+		Local_u8ErrorState = EXTI_InvalidStormLimit;
+	}
+
+	else
+	{
+		EXTI_Storm_t * Local_pStorm = &EXTI_Storms[Copy_u8InterruptLine];
+
+		/*The ISR ignores the limit while it's being written*/
+		Local_pStorm -> MaxEdges = 0;
+		__asm__ volatile ("" ::: "memory");
+
+		Local_pStorm -> WindowCycles = Copy_pLimit -> WindowCycles;
+		Local_pStorm -> CooldownCycles = Copy_pLimit -> CooldownCycles;
+		Local_pStorm -> WindowStart = EXTI_EVENT_TIMESTAMP();
+		Local_pStorm -> WindowCount = 0;
+
+		__asm__ volatile ("" ::: "memory");
+		Local_pStorm -> MaxEdges = Copy_pLimit -> MaxEdges;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the func notified from the ISR when a line is masked
+ * 	Parameters:                 - void (*Copy_pStormCallBack)(EXTI_ExtIntLine_t): the func, NULL for none
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               The func runs in the masked line ISR
+ * 	Post Conditions:            The storms are reported
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetStormCallBack(void (*Copy_pStormCallBack)(EXTI_ExtIntLine_t Copy_u8InterruptLine))
+{
+	EXTI_pStormCallBack = Copy_pStormCallBack;
+
+	return EXTI_Exit_OK;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to re-arm the lines masked by the storm guard whose cooldown
+ * 								is over, it's also run by EXTI_ProcessEvents()
+ * 	Parameters:                 - None
+ * 	Returns:                    - uint32_t: the number of lines re-armed
+ * 	Preconditions:              -  Called periodically from a single context (the main loop or a timer tick)
+ * 	Side effects:               The edges latched while masked are dropped, counted as one
+ * 	Post Conditions:            The cooled down lines are enabled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+uint32_t EXTI_StormTick(void)
+{
+	uint32_t Local_u32Rearmed = 0;
+	uint32_t Local_u32Now = EXTI_EVENT_TIMESTAMP();
+	uint8_t Local_u8Line;
+
+	for(Local_u8Line = 0; Local_u8Line <= INTERRUPT_LINES_NUM; Local_u8Line++)
+	{
+		EXTI_Storm_t * Local_pStorm = &EXTI_Storms[Local_u8Line];
+
+		if((Local_pStorm -> IsMasked) && ((Local_u32Now - (Local_pStorm -> MaskedAt)) >= (Local_pStorm -> CooldownCycles)))
+		{
+			/*PR still latches the edges of a masked line*/
+			if(1 & ((EXTI -> PR) >> Local_u8Line))
+			{
+				EXTI -> PR = (1UL << Local_u8Line);
+				Local_pStorm -> Dropped++;
+			}
+
+			Local_pStorm -> WindowStart = Local_u32Now;
+			Local_pStorm -> WindowCount = 0;
+			Local_pStorm -> IsMasked = 0;
+
+			BITBAND_PERIPH(EXTI -> IMR, Local_u8Line) = 1;
+			Local_u32Rearmed++;
+		}
+	}
+
+	return Local_u32Rearmed;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the fired, dropped & masked counters of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- EXTI_LineStats_t *Copy_pStats: ptr to receive the counters
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_STORM_GUARD is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The counters are retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetLineStats(EXTI_ExtIntLine_t Copy_u8InterruptLine, EXTI_LineStats_t *Copy_pStats)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(Copy_pStats == NULL)
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
+
+	else if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else
+	{
+		Copy_pStats -> Fired = EXTI_Storms[Copy_u8InterruptLine].Fired;
+		Copy_pStats -> Dropped = EXTI_Storms[Copy_u8InterruptLine].Dropped;
+		Copy_pStats -> Masked = EXTI_Storms[Copy_u8InterruptLine].Masked;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the counters of the EXTI line
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               An edge serviced while clearing may be lost from the counters
+ * 	Post Conditions:            The counters are zeroed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ClearLineStats(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		EXTI_Storms[Copy_u8InterruptLine].Fired = 0;
+		EXTI_Storms[Copy_u8InterruptLine].Dropped = 0;
+		EXTI_Storms[Copy_u8InterruptLine].Masked = 0;
+	}
+
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edges count of the EXTI line in counter mode
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t *Copy_pu32Count: ptr to receive the edges counted since the mode was set, wraps at 2^32
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line is in EXTI_MODE_COUNTER
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The count is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetCount(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t *Copy_pu32Count)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(Copy_pu32Count == NULL)
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
+
+	else if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if(EXTI_LineModes[Copy_u8InterruptLine] != EXTI_MODE_COUNTER)
+	{
+		Local_u8ErrorState = EXTI_InvalidLineMode;
+	}
+
+	else
+	{
+		*Copy_pu32Count = EXTI_Counts[Copy_u8InterruptLine];
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the gate window of the EXTI line frequency: the edges
+ * 								counted over each window are latched by EXTI_FreqTick()
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t Copy_u32GateTicks: the window in EXTI_FreqTick() calls, 0 to stop the measurement
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  The line is in EXTI_MODE_COUNTER
+ * 	Side effects:               The previous measurement is discarded
+ * 	Post Conditions:            The frequency is valid after a full window
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_SetGateWindow(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t Copy_u32GateTicks)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if(EXTI_LineModes[Copy_u8InterruptLine] != EXTI_MODE_COUNTER)
+	{
+		Local_u8ErrorState = EXTI_InvalidLineMode;
+	}
+
+	else
+	{
+		EXTI_Gate_t * Local_pGate = &EXTI_Gates[Copy_u8InterruptLine];
+
+		/*The tick skips the line while its gate is being written*/
+		EXTI_u32GatedLines &= ~(1UL << Copy_u8InterruptLine);
+		__asm__ volatile ("" ::: "memory");
+
+		Local_pGate -> IsValid = 0;
+
+		if(Copy_u32GateTicks != 0u)
+		{
+			Local_pGate -> GateTicks = Copy_u32GateTicks;
+			Local_pGate -> TicksLeft = Copy_u32GateTicks;
+			Local_pGate -> LastCount = EXTI_Counts[Copy_u8InterruptLine];
+
+			__asm__ volatile ("" ::: "memory");
+			EXTI_u32GatedLines |= (1UL << Copy_u8InterruptLine);
+		}
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is the gate time base of the counter lines, to be called at EXTI_FREQ_TICK_HZ
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called from a single context, e.g. the SysTick ISR
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The lines whose window ended have their gate count latched
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void EXTI_FreqTick(void)
+{
+	uint32_t Local_u32Lines = EXTI_u32GatedLines;
+
+	while(Local_u32Lines != 0u)
+	{
+		uint8_t Local_u8Line = EXTI_WORD_MSB - (uint8_t)__builtin_clz(Local_u32Lines);
+		EXTI_Gate_t * Local_pGate = &EXTI_Gates[Local_u8Line];
+
+		Local_u32Lines &= ~(1UL << Local_u8Line);
+
+		if(--(Local_pGate -> TicksLeft) == 0u)
+		{
+			uint32_t Local_u32Count = EXTI_Counts[Local_u8Line];
+
+			Local_pGate -> GateCount = Local_u32Count - (Local_pGate -> LastCount);
+			Local_pGate -> LastCount = Local_u32Count;
+			Local_pGate -> TicksLeft = Local_pGate -> GateTicks;
+			Local_pGate -> IsValid = 1;
+		}
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the edges frequency of the EXTI line over its last gate window
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint32_t *Copy_pu32FreqHz: ptr to receive the frequency in Hz, the edges of both
+ * 								  directions are counted on an EXTI_OnChange line
+ * 	Returns:                    - EXTI_ErorrStates_t: EXTI_NoMeasurement before the first full window
+ * 	Preconditions:              -  EXTI_SetGateWindow() is called for the line, the resolution is EXTI_FREQ_TICK_HZ / GateTicks
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The frequency is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_GetFrequency(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint32_t *Copy_pu32FreqHz)
+{
+	EXTI_ErrorStates_t Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(Copy_pu32FreqHz == NULL)
+	{
+		Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+	}
+
+	else if(!MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	else if(EXTI_Gates[Copy_u8InterruptLine].IsValid == 0u)
+	{
+		Local_u8ErrorState = EXTI_NoMeasurement;
+	}
+
+	else
+	{
+		*Copy_pu32FreqHz = (uint32_t)(((uint64_t)EXTI_Gates[Copy_u8InterruptLine].GateCount * EXTI_FREQ_TICK_HZ) /
+										EXTI_Gates[Copy_u8InterruptLine].GateTicks);
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the EXTI pending flag
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI pending flag is cleared
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ClearPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine)
+{
+	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
+	{
+		EXTI -> PR = 1 << Copy_u8InterruptLine;
+	}
 
-		EXTI->PR = (1 << EXTI7);
-		CallBack_FuncPtrs[EXTI7]();
+	else
+	{
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
 	}
 
-	if(EXTI8_FLAG == FLAG_RAISED)
+	return Local_u8ErrorState;
+
+}
+
+
+/**************************************************************************************************************
+ * 	Description:                 This Function is used to clear the EXTI pending flag
+ * 	Parameters:                 - EXTI_ExtIntLine_t Copy_u8InterruptLine: The Interrupt line
+ * 								- uint8_t* Copy_pPendingFlagState: a ptr to unit8_t variable that will be derfernced with the flag state
+ * 	Returns:                    - EXTI_ErorrStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_Init() must be used to init the Interrupt line first.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The EXTI pending flag state is retrieved
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+EXTI_ErrorStates_t EXTI_ReadPendingFlag(EXTI_ExtIntLine_t Copy_u8InterruptLine, uint8_t* Copy_pPendingFlagState)
+{
+	EXTI_ErrorStates_t	Local_u8ErrorState = EXTI_Exit_OK;
+
+	if(MCAL_PARAM_VALID(EXTI_IS_VALID_LINE(Copy_u8InterruptLine)))
 	{
+		if(Copy_pPendingFlagState != NULL)
+		{
+			*Copy_pPendingFlagState = (1 & ((EXTI -> PR) >> Copy_u8InterruptLine));
+		}
 
-		EXTI->PR = (1 << EXTI8);
-		CallBack_FuncPtrs[EXTI8]();
+		else
+		{
+			Local_u8ErrorState = EXTI_NULL_Ptr_Err;
+		}
 	}
 
-	if(EXTI9_FLAG == FLAG_RAISED)
+	else
 	{
-		EXTI->PR = (1 << EXTI9);
-    	CallBack_FuncPtrs[EXTI9]();
-    }
+		Local_u8ErrorState = EXTI_InvalidLineNumber;
+	}
+
+	return Local_u8ErrorState;
 }
 
 
 
-void EXTI15_10_IRQHandler()
+
+
+/*
+ *
+ * @brief: The edge that raised a line: given by its trigger config, or sampled from its source pin when it triggers on both,
+ * 			unknown (EXTI_OnChange) for an internal line triggering on both
+ *
+ * */
+static uint8_t EXTI_u8GetLineEdge(uint8_t Copy_u8Line)
+{
+	uint8_t Local_u8Edge;
+	uint8_t Local_u8Rising = (1 & ((EXTI -> RTSR) >> Copy_u8Line));
+	uint8_t Local_u8Falling = (1 & ((EXTI -> FTSR) >> Copy_u8Line));
+
+	if(Local_u8Rising != Local_u8Falling)
+	{
+		Local_u8Edge = Local_u8Rising ? EXTI_RisingEdge : EXTI_FallingEdge;
+	}
+
+	else if(Copy_u8Line > GPIO_INTERRUPT_LINES_NUM)
+	{
+		/*Internal line: no pin to sample*/
+		Local_u8Edge = EXTI_OnChange;
+	}
+
+	else
+	{
+		Local_u8Edge = EXTI_u8ReadLinePin(Copy_u8Line) ? EXTI_RisingEdge : EXTI_FallingEdge;
+	}
+
+	return Local_u8Edge;
+}
+
+
+
+/*
+ *
+ * @brief: Queuing an event from the ISR, a full queue drops the new event & counts it
+ *
+ * */
+static void EXTI_vidPushEvent(uint8_t Copy_u8Line, uint32_t Copy_u32TimeStamp)
 {
-	if(EXTI10_FLAG == FLAG_RAISED)
+	uint32_t Local_u32Head = EXTI_u32QueueHead;
+
+	if((Local_u32Head - EXTI_u32QueueTail) < EXTI_EVENT_QUEUE_SIZE)
 	{
-		/*clearing the pending flag*/
-		EXTI->PR = (1 << EXTI10);
+		EXTI_Event_t * Local_pEvent = &EXTI_EventsQueue[Local_u32Head & EXTI_EVENT_QUEUE_MASK];
+
+		Local_pEvent -> TimeStamp = Copy_u32TimeStamp;
+		Local_pEvent -> Line = Copy_u8Line;
+		Local_pEvent -> Edge = EXTI_u8GetLineEdge(Copy_u8Line);
+
+		/*The event must be written before it's published*/
+		__asm__ volatile ("" ::: "memory");
+		EXTI_u32QueueHead = Local_u32Head + 1u;
+	}
 
-		/*Invoking the callback func*/
-		CallBack_FuncPtrs[EXTI10]();
+	else
+	{
+		EXTI_u32QueueOverflows++;
 	}
+}
+
+
+
+/*
+ *
+ * @brief: Recording an edge timestamp from the ISR, the oldest capture is overwritten when the buffer is full
+ *
+ * */
+static void EXTI_vidCaptureEdge(uint8_t Copy_u8Line, uint32_t Copy_u32TimeStamp)
+{
+	EXTI_Capture_t * Local_pCapture = &EXTI_Captures[Copy_u8Line];
+	uint32_t Local_u32Count = Local_pCapture -> Count;
+	uint8_t Local_u8Slot = Local_u32Count & EXTI_CAPTURE_BUFFER_MASK;
+	uint32_t Local_u32Rising = (EXTI_u8GetLineEdge(Copy_u8Line) == EXTI_RisingEdge);
+
+	Local_pCapture -> Stamps[Local_u8Slot] = Copy_u32TimeStamp;
+	Local_pCapture -> Edges = ((Local_pCapture -> Edges) & ~(1UL << Local_u8Slot)) | (Local_u32Rising << Local_u8Slot);
+
+	/*The capture must be written before it's counted*/
+	__asm__ volatile ("" ::: "memory");
+	Local_pCapture -> Count = Local_u32Count + 1u;
+}
+
+
+
+#if EXTI_STORM_GUARD == EXTI_STORM_GUARD_ON
+/*
+ *
+ * @brief: Accounting an edge of the line: over its limit within the window the line is masked, notified and the edge dropped.
+ * 			Returns 1 if the edge is to be dispatched
+ *
+ * */
+static uint8_t EXTI_u8AdmitEdge(uint8_t Copy_u8Line, uint32_t Copy_u32TimeStamp)
+{
+	EXTI_Storm_t * Local_pStorm = &EXTI_Storms[Copy_u8Line];
+	uint8_t Local_u8Admitted = 1;
 
-	if(EXTI11_FLAG == FLAG_RAISED)
+	if(Local_pStorm -> MaxEdges != 0u)
 	{
+		if((Copy_u32TimeStamp - (Local_pStorm -> WindowStart)) >= (Local_pStorm -> WindowCycles))
+		{
+			Local_pStorm -> WindowStart = Copy_u32TimeStamp;
+			Local_pStorm -> WindowCount = 0;
+		}
+
+		Local_pStorm -> WindowCount++;
+
+		if((Local_pStorm -> WindowCount) > (Local_pStorm -> MaxEdges))
+		{
+			BITBAND_PERIPH(EXTI -> IMR, Copy_u8Line) = 0;
+
+			Local_pStorm -> MaskedAt = Copy_u32TimeStamp;
+			Local_pStorm -> IsMasked = 1;
+			Local_pStorm -> Dropped++;
+			Local_pStorm -> Masked++;
+			Local_u8Admitted = 0;
 
-		EXTI->PR = (1 << EXTI11);
-		CallBack_FuncPtrs[EXTI11]();
+			if(EXTI_pStormCallBack != NULL)
+			{
+				EXTI_pStormCallBack((EXTI_ExtIntLine_t)Copy_u8Line);
+			}
+		}
+	}
+
+	if(Local_u8Admitted)
+	{
+		Local_pStorm -> Fired++;
 	}
 
-	if(EXTI12_FLAG == FLAG_RAISED)
+	return Local_u8Admitted;
+}
+#endif
+
+
+
+/*
+ *
+ * @brief: Handling a raised line per its mode, the timestamp is taken at the ISR entry
+ *
+ * */
+static inline void EXTI_vidRunLine(uint8_t Copy_u8Line, uint32_t Copy_u32TimeStamp)
+{
+	if(EXTI_LineModes[Copy_u8Line] == EXTI_MODE_CAPTURE)
 	{
+		EXTI_vidCaptureEdge(Copy_u8Line, Copy_u32TimeStamp);
+	}
 
-		EXTI->PR = (1 << EXTI12);
-		CallBack_FuncPtrs[EXTI12]();
+	else if(EXTI_LineModes[Copy_u8Line] == EXTI_MODE_DEFERRED)
+	{
+		EXTI_vidPushEvent(Copy_u8Line, Copy_u32TimeStamp);
 	}
 
-	if(EXTI13_FLAG == FLAG_RAISED)
+	else if(EXTI_CallBacks[Copy_u8Line].Func != NULL)
 	{
+		EXTI_CallBacks[Copy_u8Line].Func(EXTI_CallBacks[Copy_u8Line].Context);
+	}
+}
+
 
-		EXTI->PR = (1 << EXTI13);
-		CallBack_FuncPtrs[EXTI13]();
+
+static inline void EXTI_vidDispatchLine(uint8_t Copy_u8Line, uint32_t Copy_u32TimeStamp)
+{
+	if(EXTI_LineModes[Copy_u8Line] == EXTI_MODE_COUNTER)
+	{
+		/*Counted inline: no call & no storm accounting, the count is the measurement*/
+		EXTI_Counts[Copy_u8Line]++;
 	}
 
-	if(EXTI14_FLAG == FLAG_RAISED)
+	else
 	{
-		EXTI->PR = (1 << EXTI14);
-    	CallBack_FuncPtrs[EXTI14]();
-    }
+#if EXTI_STORM_GUARD == EXTI_STORM_GUARD_ON
+		if(EXTI_u8AdmitEdge(Copy_u8Line, Copy_u32TimeStamp))
+		{
+			EXTI_vidRunLine(Copy_u8Line, Copy_u32TimeStamp);
+		}
+#else
+		EXTI_vidRunLine(Copy_u8Line, Copy_u32TimeStamp);
+#endif
+	}
+}
+
+
+
+
 
-	if(EXTI15_FLAG == FLAG_RAISED)
+/*
+ *
+ * @brief: Servicing the lines of a shared IRQ: PR is read once & masked by IMR, all the raised lines are
+ * 			acknowledged by a single write then their callbacks are invoked from the highest line down,
+ * 			each set bit found by a CLZ so the cost doesn't depend on which line fired
+ *
+ * */
+static void EXTI_vidServiceLines(uint32_t Copy_u32LinesMask)
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+	uint32_t Local_u32Pending = (EXTI -> PR) & (EXTI -> IMR) & Copy_u32LinesMask;
+
+	if(Local_u32Pending != 0u)
 	{
-		EXTI->PR = (1 << EXTI15);
-		CallBack_FuncPtrs[EXTI15]();
+		/*clearing all the pending flags at once*/
+		EXTI -> PR = Local_u32Pending;
+
+		while(Local_u32Pending != 0u)
+		{
+			uint8_t Local_u8Line = EXTI_WORD_MSB - (uint8_t)__builtin_clz(Local_u32Pending);
+
+			Local_u32Pending &= ~(1UL << Local_u8Line);
+
+#if EXTI_PROFILING == EXTI_PROFILING_ON
+			IRQPROF_LineFrame_t Local_Frame;
+
+			IRQPROF_LineBegin(&Local_Frame);
+			EXTI_vidDispatchLine(Local_u8Line, Local_u32TimeStamp);
+			IRQPROF_LineEnd(Local_u8Line, &Local_Frame);
+#else
+			EXTI_vidDispatchLine(Local_u8Line, Local_u32TimeStamp);
+#endif
+		}
 	}
 }
 
 
 
+
+
+/*
+ *
+ * @brief: Imblementing the IRQs
+ *
+ * */
+void EXTI0_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	/*clearing the pending flag*/
+	EXTI -> PR = (1 << EXTI0);
+
+	/*Invoking the callback func*/
+	EXTI_vidDispatchLine(EXTI0, Local_u32TimeStamp);
+
+
+}
+
+
+
+void EXTI1_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	/*clearing the pending flag*/
+	EXTI->PR = (1 << EXTI1);
+
+	/*Invoking the callback func*/
+	EXTI_vidDispatchLine(EXTI1, Local_u32TimeStamp);
+
+
+}
+
+
+
+void EXTI2_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	/*clearing the pending flag*/
+	EXTI->PR = (1 << EXTI2);
+
+	/*Invoking the callback func*/
+	EXTI_vidDispatchLine(EXTI2, Local_u32TimeStamp);
+
+
+}
+
+
+
+void EXTI3_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	/*clearing the pending flag*/
+	EXTI->PR = (1 << EXTI3);
+
+	/*Invoking the callback func*/
+	EXTI_vidDispatchLine(EXTI3, Local_u32TimeStamp);
+
+
+}
+
+
+
+void EXTI4_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	/*clearing the pending flag*/
+	EXTI->PR = (1 << EXTI4);
+
+	/*Invoking the callback func*/
+	EXTI_vidDispatchLine(EXTI4, Local_u32TimeStamp);
+
+
+}
+
+
+
+void EXTI9_5_IRQHandler()
+{
+	EXTI_vidServiceLines(EXTI9_5_LINES_MASK);
+}
+
+
+
+void EXTI15_10_IRQHandler()
+{
+	EXTI_vidServiceLines(EXTI15_10_LINES_MASK);
+}
+
+
+
+/*
+ *
+ * @brief: The internal lines IRQs, the source peripheral flag (e.g. RTC ALRAF, PWR PVDO) is cleared by the callback
+ *
+ * */
 void PVD_IRQHandler()
 {
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
 
+	EXTI -> PR = (1UL << EXTI16_PVD);
+	EXTI_vidDispatchLine(EXTI16_PVD, Local_u32TimeStamp);
 }
 
 
 
-void TAMP_STAMP_IRQHandler()
+void RTC_Alarm_IRQHandler()
 {
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
 
+	EXTI -> PR = (1UL << EXTI17_RTC_ALARM);
+	EXTI_vidDispatchLine(EXTI17_RTC_ALARM, Local_u32TimeStamp);
 }
 
-void RTC_WKUP_IRQHandler()
+
+
+void OTG_FS_WKUP_IRQHandler()
 {
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
 
+	EXTI -> PR = (1UL << EXTI18_OTG_FS_WKUP);
+	EXTI_vidDispatchLine(EXTI18_OTG_FS_WKUP, Local_u32TimeStamp);
 }
 
 
 
+void OTG_HS_WKUP_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	EXTI -> PR = (1UL << EXTI20_OTG_HS_WKUP);
+	EXTI_vidDispatchLine(EXTI20_OTG_HS_WKUP, Local_u32TimeStamp);
+}
+
+
+
+void TAMP_STAMP_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
 
+	EXTI -> PR = (1UL << EXTI21_TAMP_STAMP);
+	EXTI_vidDispatchLine(EXTI21_TAMP_STAMP, Local_u32TimeStamp);
+}
+
+
+
+void RTC_WKUP_IRQHandler()
+{
+	uint32_t Local_u32TimeStamp = EXTI_EVENT_TIMESTAMP();
+
+	EXTI -> PR = (1UL << EXTI22_RTC_WKUP);
+	EXTI_vidDispatchLine(EXTI22_RTC_WKUP, Local_u32TimeStamp);
+}
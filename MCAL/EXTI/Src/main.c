@@ -16,22 +16,16 @@
 #include "NVIC_Interface.h"
 #include "SYSCFG_Interface.h"
 #include "EXTI_Interface.h"
+#include "EXTI_BIND_Interface.h"
 
 
 
 
 /*App func prototype*/
-void AppFunc(void);
+void AppFunc(void *Copy_pContext);
 
 
 /*Configs structs*/
-PinConfig_t PC13_UsrButton = {
-								.Mode = INPUT,
-								.Port = PORTC,
-								.PinNum = PIN13,
-								.PullType = NO_PULL,
-};
-
 PinConfig_t PA05_LED2 = {
 
 							   .Mode = OUTPUT,
@@ -46,15 +40,6 @@ PinConfig_t PA05_LED2 = {
 
 
 
-EXTI_Configs_t PC13_EXTIConfigs = {
-										.InitStat = EXTI_DISABLED,
-										.IntLine = EXTI13,
-										.TrigType = EXTI_FallingEdge,
-										.callBackFunc = &AppFunc,
-};
-
-
-
 uint8_t Local_u8ButtonTest = 1;
 
 int main(void)
@@ -62,34 +47,33 @@ int main(void)
 	RCC_SetClkStatus(HSI, ON);
 	RCC_SetSysClk(HSI);
 
-	RCC_AHB1EnableClk(AHB1_GPIOC);
 	RCC_AHB1EnableClk(AHB1_GPIOA);
-	RCC_APB2EnableClk(APB2_SYSCFG);
 
-	GPIO_u8PinInit((PinConfig_t *) &PC13_UsrButton);
 	GPIO_u8PinInit((PinConfig_t *) &PA05_LED2);
-
-
-	SYSCFG_SetEXTIPort(SYSCFG_PORTC, SYSCFG_EXTI13);
 	//GPIO_u8TogglePinValue(PORTA, PIN5);
 
-	EXTI_Init((EXTI_Configs_t *) &PC13_EXTIConfigs);
-	EXTI_EnableInterrupt(PC13_EXTIConfigs.IntLine);
+	/*Deferred before the line is armed, so no edge runs AppFunc from the ISR*/
+	EXTI_SetLineMode(EXTI13, EXTI_MODE_DEFERRED);
 
-	NVIC_SetPriority(IRQ40_EXTI15_10, 0b0101);
-	NVIC_EnableIRQ(IRQ40_EXTI15_10);
+	/*GPIOC & SYSCFG clks, PC13 input, EXTI13 routing & edge, IRQ40_EXTI15_10 priority & enable*/
+	EXTI_BindPin(PORTC, PIN13, EXTI_FallingEdge, 0b0101, &AppFunc, NULL);
 
 
 
     /* Loop forever */
 	for(;;)
 	{
+		/*AppFunc runs here, out of the ISR*/
+		EXTI_ProcessEvents();
+
 		//GPIO_u8ReadPinValue(PORTC, PIN13, (PinVal_t*) &Local_u8ButtonTest);
 	}
 }
 
 
-void AppFunc(void)
+void AppFunc(void *Copy_pContext)
 {
+	(void)Copy_pContext;
+
 	GPIO_u8TogglePinValue(PORTA, PIN5);
 }
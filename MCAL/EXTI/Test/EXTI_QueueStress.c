@@ -0,0 +1,312 @@
+/***************************************************************************************************
+ * @file: 			EXTI_QueueStress.c
+ * @brief: 			Host stress test of the deferred events queue (EXTI_Prog.c): a producer thread standing in for
+ * 					the EXTI ISRs pushes numbered events while the main thread pops them, each on its own CPU
+ * 					when there are several. A last pass pushes the events from a timer signal handler so the
+ * 					pops are preempted anywhere, like the ISR preempts the main loop on the target.
+ * 					EXTI_Prog.c is included so the static push is reachable. The registers window is mapped
+ * 					as plain memory (no HOSTSIM_Init, the access traps do not mix with threads), RTSR is set so
+ * 					the edge of every line is read from the registers only.
+ * 					Pass 1 retries every dropped push: all the events must come out once, in order & untorn.
+ * 					Pass 2 never retries: the popped events must stay in order and popped + overflows must
+ * 					equal the pushed events. The signal pass never retries either. Returns the failures count.
+ * 					Build (from the repo root):
+ * 						gcc -std=gnu11 -O2 -DMCAL_HOST_SIM -ILIB -IHOST_SIM/Inc -IMCAL/DWT/Inc -IMCAL/EXTI/Inc \
+ * 							MCAL/EXTI/Test/EXTI_QueueStress.c MCAL/DWT/Src/DWT_Prog.c HOST_SIM/Src/HOSTSIM_Prog.c \
+ * 							-lpthread -o exti_queue_stress
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#define _GNU_SOURCE
+#include "../Src/EXTI_Prog.c"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+
+#define TEST_EVENTS				5000000u
+#define TEST_REGS_BASE			((void *)0x40000000UL)
+#define TEST_REGS_SIZE			0x100000UL
+#define TEST_ISR_PERIOD_NS		10000L
+#define TEST_ISR_MAX_BURST		40u
+
+
+typedef struct
+{
+	uint32_t Popped;
+	uint32_t Lost;				/*Sequence numbers skipped*/
+	uint32_t Torn;				/*Line or edge not matching the sequence number*/
+	uint32_t Reordered;			/*Sequence number going back*/
+	uint32_t Overflows;
+
+}TEST_Result_t;
+
+
+static volatile uint32_t TEST_u32ProducerDone;
+static volatile uint32_t TEST_u32IsrSeq;
+
+
+
+/*
+ *
+ * @brief: The line an event number is pushed on, all the valid lines are walked (19 is reserved)
+ *
+ * */
+static uint8_t TEST_u8EventLine(uint32_t Copy_u32Seq)
+{
+	uint8_t Local_u8Line = (uint8_t)(Copy_u32Seq % INTERRUPT_LINES_NUM);
+
+	return (Local_u8Line < 19u) ? Local_u8Line : (uint8_t)(Local_u8Line + 1u);
+}
+
+
+
+/*
+ *
+ * @brief: Checking a popped event against the next expected event number
+ *
+ * */
+static void TEST_vidCheckEvent(TEST_Result_t *Copy_pResult, const EXTI_Event_t *Copy_pEvent, uint32_t *Copy_pu32Expected)
+{
+	if(Copy_pEvent -> TimeStamp < *Copy_pu32Expected)
+	{
+		Copy_pResult -> Reordered++;
+	}
+
+	else
+	{
+		Copy_pResult -> Lost += Copy_pEvent -> TimeStamp - *Copy_pu32Expected;
+		*Copy_pu32Expected = Copy_pEvent -> TimeStamp + 1u;
+	}
+
+	if((Copy_pEvent -> Line != TEST_u8EventLine(Copy_pEvent -> TimeStamp)) || (Copy_pEvent -> Edge != EXTI_RisingEdge))
+	{
+		Copy_pResult -> Torn++;
+	}
+
+	Copy_pResult -> Popped++;
+}
+
+
+
+static void TEST_vidResetQueue(void)
+{
+	EXTI_u32QueueHead = 0;
+	EXTI_u32QueueTail = 0;
+	EXTI_u32QueueOverflows = 0;
+}
+
+
+
+static void TEST_vidPinToCPU(long Copy_CPU)
+{
+	long Local_CPUs = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if(Local_CPUs > 1)
+	{
+		cpu_set_t Local_Set;
+
+		CPU_ZERO(&Local_Set);
+		CPU_SET(Copy_CPU % Local_CPUs, &Local_Set);
+		pthread_setaffinity_np(pthread_self(), sizeof(Local_Set), &Local_Set);
+	}
+}
+
+
+
+/*
+ *
+ * @brief: The ISR side, the event number is the timestamp. A push that raised the overflows gives the CPU away
+ * 			and is retried when asked
+ *
+ * */
+static void *TEST_pvProducer(void *Copy_pRetry)
+{
+	uint32_t Local_u32Seq = 0;
+	int Local_Retry = *(int *)Copy_pRetry;
+
+	TEST_vidPinToCPU(1);
+
+	while(Local_u32Seq < TEST_EVENTS)
+	{
+		uint32_t Local_u32Before = EXTI_u32QueueOverflows;
+
+		EXTI_vidPushEvent(TEST_u8EventLine(Local_u32Seq), Local_u32Seq);
+
+		if(EXTI_u32QueueOverflows == Local_u32Before)
+		{
+			Local_u32Seq++;
+		}
+
+		else
+		{
+			Local_u32Seq += (Local_Retry == 0);
+			sched_yield();
+		}
+	}
+
+	TEST_u32ProducerDone = 1;
+
+	return NULL;
+}
+
+
+
+static TEST_Result_t TEST_stRunPass(int Copy_Retry)
+{
+	TEST_Result_t Local_Result = {0};
+	pthread_t Local_Producer;
+	EXTI_Event_t Local_Event;
+	uint32_t Local_u32Expected = 0;
+
+	TEST_vidResetQueue();
+	TEST_u32ProducerDone = 0;
+
+	pthread_create(&Local_Producer, NULL, TEST_pvProducer, &Copy_Retry);
+
+	while(1)
+	{
+		uint32_t Local_u32Done = TEST_u32ProducerDone;
+
+		if(EXTI_PopEvent(&Local_Event) == EXTI_Exit_OK)
+		{
+			TEST_vidCheckEvent(&Local_Result, &Local_Event, &Local_u32Expected);
+		}
+
+		else if(Local_u32Done)
+		{
+			/*The producer was done before the empty queue was seen*/
+			break;
+		}
+
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	pthread_join(Local_Producer, NULL);
+	EXTI_GetEventOverflows(&Local_Result.Overflows);
+
+	/*Events dropped after the last popped one*/
+	Local_Result.Lost += TEST_EVENTS - Local_u32Expected;
+
+	return Local_Result;
+}
+
+
+
+/*
+ *
+ * @brief: The ISR of the signal pass, a burst of 1 ~ TEST_ISR_MAX_BURST events, the full queue drops them
+ *
+ * */
+static void TEST_vidIsr(int Copy_Signal)
+{
+	uint32_t Local_u32Seq = TEST_u32IsrSeq;
+	uint32_t Local_u32Last = Local_u32Seq + 1u + (Local_u32Seq % TEST_ISR_MAX_BURST);
+
+	(void)Copy_Signal;
+
+	if(Local_u32Last > TEST_EVENTS)
+	{
+		Local_u32Last = TEST_EVENTS;
+	}
+
+	for(; Local_u32Seq < Local_u32Last; Local_u32Seq++)
+	{
+		EXTI_vidPushEvent(TEST_u8EventLine(Local_u32Seq), Local_u32Seq);
+	}
+
+	TEST_u32IsrSeq = Local_u32Seq;
+}
+
+
+
+static TEST_Result_t TEST_stRunIsrPass(void)
+{
+	TEST_Result_t Local_Result = {0};
+	EXTI_Event_t Local_Event;
+	uint32_t Local_u32Expected = 0;
+	timer_t Local_Timer;
+	struct sigevent Local_Event_Cfg = {.sigev_notify = SIGEV_SIGNAL, .sigev_signo = SIGALRM};
+	struct itimerspec Local_Period = {.it_interval = {0, TEST_ISR_PERIOD_NS}, .it_value = {0, TEST_ISR_PERIOD_NS}};
+	struct itimerspec Local_Stop = {0};
+
+	TEST_vidResetQueue();
+	TEST_u32IsrSeq = 0;
+
+	signal(SIGALRM, TEST_vidIsr);
+	timer_create(CLOCK_MONOTONIC, &Local_Event_Cfg, &Local_Timer);
+	timer_settime(Local_Timer, 0, &Local_Period, NULL);
+
+	while(1)
+	{
+		uint32_t Local_u32Done = (TEST_u32IsrSeq == TEST_EVENTS);
+
+		if(EXTI_PopEvent(&Local_Event) == EXTI_Exit_OK)
+		{
+			TEST_vidCheckEvent(&Local_Result, &Local_Event, &Local_u32Expected);
+		}
+
+		else if(Local_u32Done)
+		{
+			break;
+		}
+	}
+
+	timer_settime(Local_Timer, 0, &Local_Stop, NULL);
+	timer_delete(Local_Timer);
+	EXTI_GetEventOverflows(&Local_Result.Overflows);
+	Local_Result.Lost += TEST_EVENTS - Local_u32Expected;
+
+	return Local_Result;
+}
+
+
+
+int main(void)
+{
+	uint32_t Local_u32Fails = 0;
+	TEST_Result_t Local_Result;
+
+	if(mmap(TEST_REGS_BASE, TEST_REGS_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != TEST_REGS_BASE)
+	{
+		printf("registers window map failed\n");
+		return 1;
+	}
+
+	EXTI -> RTSR = EXTI_VALID_LINES_MASK;
+	EXTI -> FTSR = 0;
+	TEST_vidPinToCPU(0);
+
+	printf("queue size %u, %u events per pass, %ld CPUs\n", (unsigned)EXTI_EVENT_QUEUE_SIZE, TEST_EVENTS, sysconf(_SC_NPROCESSORS_ONLN));
+
+	Local_Result = TEST_stRunPass(1);
+	printf("retry:    popped %u lost %u torn %u reordered %u overflows (retried) %u\n",
+			Local_Result.Popped, Local_Result.Lost, Local_Result.Torn, Local_Result.Reordered, Local_Result.Overflows);
+	Local_u32Fails += (Local_Result.Popped != TEST_EVENTS) + (Local_Result.Lost != 0) + (Local_Result.Torn != 0) + (Local_Result.Reordered != 0);
+
+	Local_Result = TEST_stRunPass(0);
+	printf("no retry: popped %u lost %u torn %u reordered %u overflows %u\n",
+			Local_Result.Popped, Local_Result.Lost, Local_Result.Torn, Local_Result.Reordered, Local_Result.Overflows);
+	Local_u32Fails += (Local_Result.Popped + Local_Result.Overflows != TEST_EVENTS) + (Local_Result.Lost != Local_Result.Overflows)
+					+ (Local_Result.Torn != 0) + (Local_Result.Reordered != 0);
+
+	Local_Result = TEST_stRunIsrPass();
+	printf("signal:   popped %u lost %u torn %u reordered %u overflows %u\n",
+			Local_Result.Popped, Local_Result.Lost, Local_Result.Torn, Local_Result.Reordered, Local_Result.Overflows);
+	Local_u32Fails += (Local_Result.Popped + Local_Result.Overflows != TEST_EVENTS) + (Local_Result.Lost != Local_Result.Overflows)
+					+ (Local_Result.Torn != 0) + (Local_Result.Reordered != 0);
+
+	printf("%s (%u failures)\n", Local_u32Fails ? "FAILED" : "ALL OK", Local_u32Fails);
+
+	return (int)Local_u32Fails;
+}
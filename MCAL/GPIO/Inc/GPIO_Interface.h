@@ -5,7 +5,9 @@
 
 /******************* Defs *******************/
 
+#ifndef NULL
 #define NULL ((void *)0)
+#endif
 
 /******************* Masks *******************/
 #define GPIO_1BIT_MASK  0b1
@@ -20,7 +22,8 @@ typedef enum
 	GPIO_Exit_OK = 0,
 	GPIO_InvalidPortName,
 	GPIO_InvalidPinNum,
-	GPIO_NullPtr
+	GPIO_NullPtr,
+	GPIO_LockFailed
 
 
 }GPIOErrorStates_t;
@@ -177,6 +180,25 @@ uint8_t GPIO_u8PinInit(const PinConfig_t * PinConfigs);
 
 
 
+/****************************************************************************************************
+ * 	Decription: This Function is used to init a group of GPIO pins, the configs of each port are
+ * 				merged first then every config register of the port is written once.
+ * 	Parameters: - const PinConfig_t * PinsConfigs: is a pointer to an array of pins configs.
+ * 				- uint8_t Copy_u8PinsCount: is the number of configs in the array.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for the GPIO Peripherals used
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins are configed, nothing is written if any config is invalid
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8PortInit(const PinConfig_t * PinsConfigs, uint8_t Copy_u8PinsCount);
+
+
+
+
+
 /****************************************************************************************************
  * 	Decription: This Function is used to set a GPIO pin.			 						
  * 	Parameters: - port_t Port: is an enum holding the port.
@@ -236,6 +258,87 @@ uint8_t GPIO_u8ReadPinValue(Port_t Port, Pin_t PinNum, PinVal_t* PinVal);
 
 
 
+/****************************************************************************************************
+ * 	Decription: This Function is used to write a group of pins of the same port (e.g. a parallel bus)
+ * 				in a single BSRR store: pins in the mask are set or reset, the others are untouched.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- uint16_t Copy_u16Mask: the pins to be written, bit n for pin n.
+ *				- uint16_t Copy_u16Value: the new values of the pins, bit n for pin n.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pins are Configed usin GPIO_u8PinInit as OUTPUT
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins are set to the values
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8WriteBus(Port_t Port, uint16_t Copy_u16Mask, uint16_t Copy_u16Value);
+
+
+
+
+
+/****************************************************************************************************
+ * 	Decription: This Function is used to read a group of pins of the same port in a single IDR load.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- uint16_t Copy_u16Mask: the pins to be read, bit n for pin n.
+ *				- uint16_t* Copy_pu16Value: is a ptr to recive the masked pins values by reference.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pins are Configed usin GPIO_u8PinInit as INPUT
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins are read
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8ReadBus(Port_t Port, uint16_t Copy_u16Mask, uint16_t* Copy_pu16Value);
+
+
+
+
+
+/****************************************************************************************************
+ * 	Decription: This Function is used to lock the configs of a group of pins of the same port using the
+ * 				LCKR key sequence, the configs of locked pins can't be changed till the next reset.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- uint16_t Copy_u16Mask: the pins to be locked, bit n for pin n.
+ * 	Returns: uint8_t errorState: GPIO_LockFailed if the lock is not confirmed, the port LCKR can only be
+ * 				programmed once per reset so the mask must hold all the pins to be locked on this port
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pins are configed using GPIO_u8PinInit or GPIO_u8PortInit
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins configs are locked
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+uint8_t GPIO_u8LockPins(Port_t Port, uint16_t Copy_u16Mask);
+
+
+
+
+
+/****************************************************************************************************
+ * 	Decription: This Function is used to check whether a GPIO pin configs are locked.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- Pin_t PinNum: is an enum holding the pin number.
+ *				- uint8_t* Copy_pu8IsLocked: is a ptr to recive 1 if the pin is locked, 0 if not.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ * 	Side effects: No side effects
+ * 	Post Conditions: the lock state is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8IsPinLocked(Port_t Port, Pin_t PinNum, uint8_t* Copy_pu8IsLocked);
+
+
+
+
+
 
 
 
@@ -0,0 +1,144 @@
+/***************************************************************************************************
+ * @file: 			GPIO_Pin.hpp
+ * @brief: 			This file contains a header-only C++ layer over the GPIO peripheral where the pin
+ * 					configs are template parameters: the registers masks & values are computed and
+ * 					checked at compile time, so Set/Clear/Read are a single register access.
+ * 					The C API in GPIO_Interface.h stays the way to go for pins selected at runtime.
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			8 - 10 -2024
+ ****************************************************************************************************/
+#ifndef GPIO_PIN_HPP
+#define GPIO_PIN_HPP
+
+#include <stdint.h>
+#include <cstddef>			/*The C++ NULL, before the C headers so they keep it*/
+
+extern "C"
+{
+#include "Stm32F446xx.h"
+#include "GPIO_Interface.h"
+}
+
+
+
+/*
+ *
+ * @brief: A GPIO pin described at compile time, e.g:
+ * 			typedef GPIO_Pin<PORTA, PIN5, OUTPUT> LED2;
+ * 			LED2::Init(); LED2::Set();
+ *
+ * */
+template<Port_t Port, Pin_t PinNum, Mode_t Mode,
+		 OutputType_t OutputType = PUSH_PULL,
+		 OutputSpeed_t Speed = LOW_SPEED,
+		 PullUpDown_t PullType = NO_PULL,
+		 AltFunc_t AltFunc = AF0>
+class GPIO_Pin
+{
+	static_assert((Port >= PORTA) && (Port <= PORTH), "GPIO_Pin: invalid port");
+	static_assert((PinNum >= PIN0) && (PinNum <= PIN15), "GPIO_Pin: invalid pin number");
+	static_assert((Mode >= INPUT) && (Mode <= ANALOG), "GPIO_Pin: invalid mode");
+	static_assert((PullType >= NO_PULL) && (PullType <= PULL_DOWN), "GPIO_Pin: invalid pull-up/down config");
+	static_assert((AltFunc >= AF0) && (AltFunc <= AF15), "GPIO_Pin: invalid alternate function");
+
+	static_assert((Mode == OUTPUT) || (Mode == ALT_FUNC) || ((OutputType == PUSH_PULL) && (Speed == LOW_SPEED)),
+				  "GPIO_Pin: output type & speed only apply to OUTPUT and ALT_FUNC pins");
+	static_assert((Mode == ALT_FUNC) || (AltFunc == AF0),
+				  "GPIO_Pin: alternate function only applies to ALT_FUNC pins");
+	static_assert((Mode != ANALOG) || (PullType == NO_PULL),
+				  "GPIO_Pin: analog pins can't have pull-up/down");
+
+public:
+
+	/*Registers masks & values of this pin*/
+	static constexpr uint32_t PinMask       = (1UL << PinNum);
+
+	static constexpr uint32_t MODERMask     = ((uint32_t)GPIO_2BIT_MASK << (PinNum * 2));
+	static constexpr uint32_t MODERValue    = ((uint32_t)Mode << (PinNum * 2));
+
+	static constexpr bool     HasOutput     = ((Mode == OUTPUT) || (Mode == ALT_FUNC));
+	static constexpr uint32_t OTYPERMask    = HasOutput ? PinMask : 0UL;
+	static constexpr uint32_t OTYPERValue   = HasOutput ? ((uint32_t)OutputType << PinNum) : 0UL;
+	static constexpr uint32_t OSPEEDRMask   = HasOutput ? MODERMask : 0UL;
+	static constexpr uint32_t OSPEEDRValue  = HasOutput ? ((uint32_t)Speed << (PinNum * 2)) : 0UL;
+
+	static constexpr uint32_t PUPDRMask     = MODERMask;
+	static constexpr uint32_t PUPDRValue    = ((uint32_t)PullType << (PinNum * 2));
+
+	static constexpr uint8_t  AFRNum        = (PinNum / 8);
+	static constexpr uint32_t AFRMask       = (Mode == ALT_FUNC) ? ((uint32_t)GPIO_4BIT_MASK << ((PinNum % 8) * 4)) : 0UL;
+	static constexpr uint32_t AFRValue      = (Mode == ALT_FUNC) ? ((uint32_t)AltFunc << ((PinNum % 8) * 4)) : 0UL;
+
+
+
+	/****************************************************************************************************
+	 * 	Decription: This Function is used to init the pin, only the registers relevant to its mode are written.
+	 * 	Preconditions: - RCC is initialized and working
+	 * 				   - Clk enabled for GPIO Peripheral
+	 ***************************************************************************************************/
+	static inline void Init(void)
+	{
+		GPIO_RegDef_t * GPIOx = Regs();
+
+		GPIOx -> MODER = ((GPIOx -> MODER) & ~MODERMask) | MODERValue;
+
+		if (HasOutput)
+		{
+			GPIOx -> OTYPER  = ((GPIOx -> OTYPER) & ~OTYPERMask) | OTYPERValue;
+			GPIOx -> OSPEEDR = ((GPIOx -> OSPEEDR) & ~OSPEEDRMask) | OSPEEDRValue;
+		}
+
+		GPIOx -> PUPDR = ((GPIOx -> PUPDR) & ~PUPDRMask) | PUPDRValue;
+
+		if (Mode == ALT_FUNC)
+		{
+			GPIOx -> AFR[AFRNum] = ((GPIOx -> AFR[AFRNum]) & ~AFRMask) | AFRValue;
+		}
+	}
+
+
+	/*Single BSRR store each*/
+	static inline void Set(void)	{ Regs() -> BSRR = PinMask; }
+	static inline void Clear(void)	{ Regs() -> BSRR = (PinMask << 16); }
+
+	static inline void Write(PinVal_t PinVal)
+	{
+		Regs() -> BSRR = (PinVal == LOW) ? (PinMask << 16) : PinMask;
+	}
+
+
+	/*ODR is read once, the toggle is applied through BSRR*/
+	static inline void Toggle(void)
+	{
+		uint32_t Local_u32ODR = Regs() -> ODR;
+
+		Regs() -> BSRR = ((Local_u32ODR & PinMask) << 16) | (~Local_u32ODR & PinMask);
+	}
+
+
+	/*Single IDR load*/
+	static inline PinVal_t Read(void)
+	{
+		return (PinVal_t)(((Regs() -> IDR) >> PinNum) & (uint32_t)GPIO_1BIT_MASK);
+	}
+
+
+private:
+
+	/*Resolved at compile time since Port is a template parameter*/
+	static inline GPIO_RegDef_t * Regs(void)
+	{
+		return (Port == PORTA) ? GPIOA :
+			   (Port == PORTB) ? GPIOB :
+			   (Port == PORTC) ? GPIOC :
+			   (Port == PORTD) ? GPIOD :
+			   (Port == PORTE) ? GPIOE :
+			   (Port == PORTF) ? GPIOF :
+			   (Port == PORTG) ? GPIOG : GPIOH;
+	}
+};
+
+
+
+#endif
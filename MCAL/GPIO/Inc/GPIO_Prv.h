@@ -0,0 +1,44 @@
+/***************************************************************************************************
+ * @file: 			GPIO_Prv.h
+ * @brief: 			This file contains the private definitions for the GPIO peripheral
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			8 - 10 -2024
+ ****************************************************************************************************/
+#ifndef GPIO_PRV_H
+#define GPIO_PRV_H
+
+
+#define GPIO_PORTS_NUM				8u			/*PORTA ~ PORTH*/
+#define GPIO_AFR_PINS_NUM			8u			/*Pins per AFR register, 4 bits each*/
+
+/*BSRR: bits 0~15 set the ODR bits, bits 16~31 reset them, both written in a single store*/
+#define GPIO_BSRR_RESET_OFFSET		16u
+
+/*LCKR: bits 0~15 select the pins, LCKK (bit 16) is the lock key, the pins are frozen till the next reset*/
+#define GPIO_LCKR_LCKK				16u
+
+
+
+/*Registers image of a port: which bits are configured and their new values,
+ * applied with one masked write per register*/
+typedef struct
+{
+	uint32_t Mask;
+	uint32_t Value;
+
+}GPIO_RegImage_t;
+
+typedef struct
+{
+	GPIO_RegImage_t MODER;
+	GPIO_RegImage_t OTYPER;
+	GPIO_RegImage_t OSPEEDR;
+	GPIO_RegImage_t PUPDR;
+	GPIO_RegImage_t AFR[2];
+
+}GPIO_PortImage_t;
+
+
+
+#endif
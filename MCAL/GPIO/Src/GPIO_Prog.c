@@ -11,393 +11,319 @@
 #include "stdint.h"
 
 #include "Stm32F446xx.h"
+#include "MCAL_Config.h"
+#include "GPIO_Prv.h"
 #include "GPIO_Interface.h"
 
 
 
+/*
+ *
+ * @brief: Ports registers lookup table, indexed by Port_t
+ *
+ * */
+static GPIO_RegDef_t * const GPIO_Ports[GPIO_PORTS_NUM] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG, GPIOH};
 
-/****************************************************************************************************
- * 	Decription: This Function is used to init a GPIO pin.
- * 	Parameters: - const PinConfig_t * PinConfigs: is a pointer to a struct contain the configs.
- * 	Returns: uint8_t errorState
- * 	Preconditions: - RCC is initialized and working
- * 				   - Clk enabled for GPIO Peripheral
- * 	Side effects: No side effects
- * 	Post Conditions: a GPIO Pin is configed
- * 	Synch/Asynch: Synch.
- * 	Reentrant/NonReenterant: Re
- ***************************************************************************************************/
-uint8_t GPIO_u8PinInit(const PinConfig_t * PinConfigs)
-{
-
-	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
 
-	if (((PinConfigs -> PinNum) >= 0) && ((PinConfigs -> PinNum) <= 15))
-	{
-		switch(PinConfigs -> Port)
-		{
 
-		/******************* PORTA *******************/
-			case PORTA:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOA -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOA -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
-
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOA -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOA -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
+/*
+ *
+ * @brief: Merging the configs of a pin into its port registers image
+ *
+ * */
+static void GPIO_vidAddPinToImage(GPIO_PortImage_t * PortImage, const PinConfig_t * PinConfigs)
+{
+	uint8_t Local_u8Bit2 = (PinConfigs -> PinNum) * 2;
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOA -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOA -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
+	/*Selecting The pin mode: Input, output, analog, AF*/
+	PortImage -> MODER.Mask  |= ((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2);
+	PortImage -> MODER.Value = (PortImage -> MODER.Value & ~((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2)) | ((uint32_t)(PinConfigs -> Mode) << Local_u8Bit2);
 
-				}
+	/*Output-specfic Configs*/
+	if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
+	{
+		/*Selecting Output types: Push-Pull, Open-Drain*/
+		PortImage -> OTYPER.Mask  |= ((uint32_t)GPIO_1BIT_MASK << (PinConfigs -> PinNum));
+		PortImage -> OTYPER.Value = (PortImage -> OTYPER.Value & ~((uint32_t)GPIO_1BIT_MASK << (PinConfigs -> PinNum))) | ((uint32_t)(PinConfigs -> OutputType) << (PinConfigs -> PinNum));
 
+		/*Selecting Output Speed: Low, Mid, Fast or High*/
+		PortImage -> OSPEEDR.Mask  |= ((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2);
+		PortImage -> OSPEEDR.Value = (PortImage -> OSPEEDR.Value & ~((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2)) | ((uint32_t)(PinConfigs -> Speed) << Local_u8Bit2);
+	}
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOA -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOA -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
+	/*Selecting Pull-up/down Configs*/
+	PortImage -> PUPDR.Mask  |= ((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2);
+	PortImage -> PUPDR.Value = (PortImage -> PUPDR.Value & ~((uint32_t)GPIO_2BIT_MASK << Local_u8Bit2)) | ((uint32_t)(PinConfigs -> PullType) << Local_u8Bit2);
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOA -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOA -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
+	/*AF-Specfic Configs: AFR[0] holds pins 0~7, AFR[1] holds pins 8~15*/
+	if (PinConfigs -> Mode == ALT_FUNC)
+	{
+		uint8_t Local_u8AFRNum = (PinConfigs -> PinNum) / GPIO_AFR_PINS_NUM;
+		uint8_t Local_u8AFRBit = ((PinConfigs -> PinNum) % GPIO_AFR_PINS_NUM) * 4;
 
-					else
-					{
-						GPIOA -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOA -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
+		PortImage -> AFR[Local_u8AFRNum].Mask  |= ((uint32_t)GPIO_4BIT_MASK << Local_u8AFRBit);
+		PortImage -> AFR[Local_u8AFRNum].Value = (PortImage -> AFR[Local_u8AFRNum].Value & ~((uint32_t)GPIO_4BIT_MASK << Local_u8AFRBit)) | ((uint32_t)(PinConfigs -> AltFunc) << Local_u8AFRBit);
+	}
+}
 
 
-				break;
-			}
 
-			/******************* PORTB *******************/
-			case PORTB:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOB -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOB -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+/*
+ *
+ * @brief: Writing a port registers image, one masked write per touched register
+ *
+ * */
+static void GPIO_vidApplyPortImage(GPIO_RegDef_t * GPIOx, const GPIO_PortImage_t * PortImage)
+{
+	if (PortImage -> MODER.Mask != 0)
+	{
+		GPIOx -> MODER = ((GPIOx -> MODER) & ~(PortImage -> MODER.Mask)) | (PortImage -> MODER.Value);
+	}
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOB -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOB -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
+	if (PortImage -> OTYPER.Mask != 0)
+	{
+		GPIOx -> OTYPER = ((GPIOx -> OTYPER) & ~(PortImage -> OTYPER.Mask)) | (PortImage -> OTYPER.Value);
+	}
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOB -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOB -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
+	if (PortImage -> OSPEEDR.Mask != 0)
+	{
+		GPIOx -> OSPEEDR = ((GPIOx -> OSPEEDR) & ~(PortImage -> OSPEEDR.Mask)) | (PortImage -> OSPEEDR.Value);
+	}
 
-				}
+	if (PortImage -> PUPDR.Mask != 0)
+	{
+		GPIOx -> PUPDR = ((GPIOx -> PUPDR) & ~(PortImage -> PUPDR.Mask)) | (PortImage -> PUPDR.Value);
+	}
 
+	if (PortImage -> AFR[0].Mask != 0)
+	{
+		GPIOx -> AFR[0] = ((GPIOx -> AFR[0]) & ~(PortImage -> AFR[0].Mask)) | (PortImage -> AFR[0].Value);
+	}
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOB -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOB -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
+	if (PortImage -> AFR[1].Mask != 0)
+	{
+		GPIOx -> AFR[1] = ((GPIOx -> AFR[1]) & ~(PortImage -> AFR[1].Mask)) | (PortImage -> AFR[1].Value);
+	}
+}
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOB -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOB -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
 
-					else
-					{
-						GPIOB -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOB -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
 
-				break;
-			}
 
+/****************************************************************************************************
+ * 	Decription: This Function is used to init a GPIO pin.
+ * 	Parameters: - const PinConfig_t * PinConfigs: is a pointer to a struct contain the configs.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ * 	Side effects: No side effects
+ * 	Post Conditions: a GPIO Pin is configed
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8PinInit(const PinConfig_t * PinConfigs)
+{
 
-			/******************* PORTC *******************/
-			case PORTC:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOC -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOC -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOC -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOC -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOC -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOC -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
+	if (MCAL_PARAM_VALID(((PinConfigs -> PinNum) >= 0) && ((PinConfigs -> PinNum) <= 15)))
+	{
+		if (MCAL_PARAM_VALID((PinConfigs -> Port) < GPIO_PORTS_NUM))
+		{
+			GPIO_PortImage_t Local_PortImage = {0};
 
-				}
+			GPIO_vidAddPinToImage(&Local_PortImage, PinConfigs);
+			GPIO_vidApplyPortImage(GPIO_Ports[PinConfigs -> Port], &Local_PortImage);
+		}
 
+		else
+		{
+			ErrorState = GPIO_InvalidPortName;
+		}
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOC -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOC -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
+	}
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOC -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOC -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
+	else
+	{
+		ErrorState = GPIO_InvalidPinNum;
+	}
 
-					else
-					{
-						GPIOC -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOC -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
 
-				break;
-			}
+	return ErrorState;
 
-			/******************* PORTD *******************/
-			case PORTD:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOD -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOD -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+}
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOD -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOD -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOD -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOD -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
 
-				}
 
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOD -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOD -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
+/****************************************************************************************************
+ * 	Decription: This Function is used to init a group of GPIO pins, the configs of each port are
+ * 				merged first then every config register of the port is written once.
+ * 	Parameters: - const PinConfig_t * PinsConfigs: is a pointer to an array of pins configs.
+ * 				- uint8_t Copy_u8PinsCount: is the number of configs in the array.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for the GPIO Peripherals used
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins are configed, nothing is written if any config is invalid
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8PortInit(const PinConfig_t * PinsConfigs, uint8_t Copy_u8PinsCount)
+{
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOD -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOD -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
+	uint8_t Local_u8UsedPorts = 0;
+	uint8_t Local_u8Counter;
+	uint8_t Local_u8Port;
 
-					else
-					{
-						GPIOD -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOD -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
 
+	if (PinsConfigs != NULL)
+	{
+		/*Validating all the configs first so a bad entry leaves the hardware untouched*/
+		for (Local_u8Counter = 0; Local_u8Counter < Copy_u8PinsCount; Local_u8Counter++)
+		{
+			if (!MCAL_PARAM_VALID((PinsConfigs[Local_u8Counter].PinNum >= 0) && (PinsConfigs[Local_u8Counter].PinNum <= 15)))
+			{
+				ErrorState = GPIO_InvalidPinNum;
 				break;
 			}
 
-			/******************* PORTE *******************/
-			case PORTE:
+			else if (!MCAL_PARAM_VALID(PinsConfigs[Local_u8Counter].Port < GPIO_PORTS_NUM))
 			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOE -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOE -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
-
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOE -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOE -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
-
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOE -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOE -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
-
-				}
-
-
-				/*Selecting Pull-up/down Configs*/
-				GPIOE -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOE -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
-
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOE -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOE -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-
-					else
-					{
-						GPIOE -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOE -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
-
+				ErrorState = GPIO_InvalidPortName;
 				break;
 			}
 
-			/******************* PORTF *******************/
-			case PORTF:
+			else
 			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOF -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOF -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+				Local_u8UsedPorts |= (1u << PinsConfigs[Local_u8Counter].Port);
+			}
+		}
+
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
+		if (ErrorState == GPIO_Exit_OK)
+		{
+			for (Local_u8Port = 0; Local_u8Port < GPIO_PORTS_NUM; Local_u8Port++)
+			{
+				if ((Local_u8UsedPorts >> Local_u8Port) & GPIO_1BIT_MASK)
 				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOF -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOF -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
+					GPIO_PortImage_t Local_PortImage = {0};
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOF -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOF -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
+					for (Local_u8Counter = 0; Local_u8Counter < Copy_u8PinsCount; Local_u8Counter++)
+					{
+						if (PinsConfigs[Local_u8Counter].Port == Local_u8Port)
+						{
+							GPIO_vidAddPinToImage(&Local_PortImage, &PinsConfigs[Local_u8Counter]);
+						}
+					}
 
+					GPIO_vidApplyPortImage(GPIO_Ports[Local_u8Port], &Local_PortImage);
 				}
+			}
+		}
 
+	}
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOF -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOF -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
-
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOF -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOF -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
+	else
+	{
+		ErrorState = GPIO_NullPtr;
+	}
 
-					else
-					{
-						GPIOF -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOF -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
 
-				break;
-			}
+	return ErrorState;
 
-			/******************* PORTG *******************/
-			case PORTG:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOG -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOG -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+}
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOG -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOG -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOG -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOG -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
 
-				}
 
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOG -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOG -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
+/****************************************************************************************************
+ * 	Decription: This Function is used to set a GPIO pin.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- Pin_t PinNum: is an enum holding the pin number.
+ *				- PinVal_t PinVal: is an enum holding the pin value.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pin is Configed usin GPIO_u8PinInit as OUTPUT
+ * 	Side effects: No side effects
+ * 	Post Conditions: a GPIO Pin is set to a value
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8SetPinValue(Port_t Port, Pin_t PinNum, PinVal_t PinVal)
+{
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOG -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOG -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
 
-					else
-					{
-						GPIOG -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOG -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
+	if (MCAL_PARAM_VALID((PinNum >= 0) && (PinNum <= 15)))
+	{
+		if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
+		{
+			/*Writing the pin bit in the upper half of BSRR resets it, in the lower half sets it:
+			 * a single store, no read-modify-write on ODR that an ISR could interleave with*/
+			uint8_t Local_u8BSRROffset = (PinVal == LOW) ? GPIO_BSRR_RESET_OFFSET : 0u;
 
-				break;
-			}
+			GPIO_Ports[Port] -> BSRR = ((uint32_t)GPIO_1BIT_MASK << PinNum) << Local_u8BSRROffset;
+		}
 
-			/******************* PORTH *******************/
-			case PORTH:
-			{
-				/*Selecting The pin mode: Input, output, analog, AF*/
-				GPIOH -> MODER &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOH -> MODER |= ((PinConfigs -> Mode) << ((PinConfigs -> PinNum) * 2));
+		else
+		{
+			ErrorState = GPIO_InvalidPortName;
+		}
 
-				/*Output-specfic Configs*/
-				if ((PinConfigs -> Mode == OUTPUT) || (PinConfigs -> Mode == ALT_FUNC))
-				{
-					/*Selecting Output types: Push-Pull, Open-Drain*/
-					GPIOH -> OTYPER &= ~(GPIO_1BIT_MASK << (PinConfigs -> PinNum));
-					GPIOH -> OTYPER |= ((PinConfigs -> OutputType) << (PinConfigs -> PinNum));
+	}
 
-					/*Selecting Output Speed: Low, Mid, Fast or High*/
-					GPIOH -> OSPEEDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-					GPIOH -> OSPEEDR |= ((PinConfigs -> Speed) << ((PinConfigs -> PinNum) * 2));
+	else
+	{
+		ErrorState = GPIO_InvalidPinNum;
+	}
 
-				}
 
+	return ErrorState;
+}
 
-				/*Selecting Pull-up/down Configs*/
-				GPIOH -> PUPDR &= ~(GPIO_2BIT_MASK << ((PinConfigs -> PinNum) * 2));
-				GPIOH -> PUPDR |= ((PinConfigs -> PullType) << ((PinConfigs -> PinNum) * 2));
 
-				/*AF-Specfic Configs*/
-				if (PinConfigs -> Mode == ALT_FUNC)
-				{
-					if(PinConfigs -> PinNum <= 7)
-					{
-						GPIOH -> AFR[0] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOH -> AFR[0] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
 
-					else
-					{
-						GPIOH -> AFR[1] &= ~(GPIO_4BIT_MASK << ((PinConfigs -> PinNum) * 4));
-						GPIOH -> AFR[1] |= ((PinConfigs -> AltFunc) << ((PinConfigs -> PinNum) * 4));
-					}
-				}
 
-				break;
-			}
 
+/****************************************************************************************************
+ * 	Decription: This Function is used to toggle a GPIO pin.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- Pin_t PinNum: is an enum holding the pin number.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pin is Configed usin GPIO_u8PinInit as OUTPUT
+ * 	Side effects: No side effects
+ * 	Post Conditions: a GPIO Pin is set to a value
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8TogglePinValue(Port_t Port, Pin_t PinNum)
+{
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-			default: ErrorState = GPIO_InvalidPortName; break;
+	if (MCAL_PARAM_VALID((PinNum >= 0) && (PinNum <= 15)))
+	{
+		if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
+		{
+			/*ODR is only read to know the current level, the toggle itself goes through BSRR
+			 * so the other pins of the port can't be overwritten by a stale ODR image*/
+			uint32_t Local_u32PinMask = ((uint32_t)GPIO_1BIT_MASK << PinNum);
+			uint32_t Local_u32ODR = GPIO_Ports[Port] -> ODR;
 
+			GPIO_Ports[Port] -> BSRR = ((Local_u32ODR & Local_u32PinMask) << GPIO_BSRR_RESET_OFFSET) | (~Local_u32ODR & Local_u32PinMask);
 		}
 
-
+		else
+		{
+			ErrorState = GPIO_InvalidPortName;
+		}
 	}
 
 	else
@@ -405,9 +331,7 @@ uint8_t GPIO_u8PinInit(const PinConfig_t * PinConfigs)
 		ErrorState = GPIO_InvalidPinNum;
 	}
 
-
 	return ErrorState;
-
 }
 
 
@@ -418,94 +342,85 @@ uint8_t GPIO_u8PinInit(const PinConfig_t * PinConfigs)
  * 	Decription: This Function is used to set a GPIO pin.
  * 	Parameters: - port_t Port: is an enum holding the port.
  *				- Pin_t PinNum: is an enum holding the pin number.
- *				- PinVal_t PinVal: is an enum holding the pin value.
+ *				- PinVal_t* PinVal: is a ptr to an enum to recive the value by reference.
  * 	Returns: uint8_t errorState
  * 	Preconditions: - RCC is initialized and working
  * 				   - Clk enabled for GPIO Peripheral
- *				   - Pin is Configed usin GPIO_u8PinInit as OUTPUT
+ *				   - Pin is Configed usin GPIO_u8PinInit as INPUT
  * 	Side effects: No side effects
- * 	Post Conditions: a GPIO Pin is set to a value
+ * 	Post Conditions: a GPIO Pin is read
  * 	Synch/Asynch: Synch.
  * 	Reentrant/NonReenterant: Re
  ***************************************************************************************************/
-uint8_t GPIO_u8SetPinValue(Port_t Port, Pin_t PinNum, PinVal_t PinVal)
+uint8_t GPIO_u8ReadPinValue(Port_t Port, Pin_t PinNum, PinVal_t* PinVal)
 {
-	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-	if ((PinNum >= 0) && (PinNum <= 15))
+	if (PinVal != NULL)
 	{
-		switch(Port)
+		if (MCAL_PARAM_VALID((PinNum >= 0) && (PinNum <= 15)))
 		{
-			case PORTA:
+			if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
 			{
-				GPIOA -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOA -> ODR |= ((PinVal << PinNum));
-				break;
+				*PinVal = (((GPIO_Ports[Port] -> IDR) >> PinNum) & (1));
 			}
 
-			case PORTB:
+			else
 			{
-				GPIOB -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOB -> ODR |= ((PinVal << PinNum));
-				break;
+				ErrorState = GPIO_InvalidPortName;
 			}
+		}
 
-			case PORTC:
-			{
-				GPIOC -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOC -> ODR |= ((PinVal << PinNum));
-				break;
-			}
+		else
+		{
+			ErrorState = GPIO_InvalidPinNum;
+		}
+	}
 
-			case PORTD:
-			{
-				GPIOD -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOD -> ODR |= ((PinVal << PinNum));
-				break;
-			}
+	else
+	{
+		ErrorState = GPIO_NullPtr;
+	}
 
-			case PORTE:
-			{
-				GPIOE -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOE -> ODR |= ((PinVal << PinNum));
-				break;
-			}
+	return ErrorState;
 
-			case PORTF:
-			{
-				GPIOF -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOF -> ODR |= ((PinVal << PinNum));
-				break;
-			}
+}
 
-			case PORTG:
-			{
-				GPIOG -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOG -> ODR |= ((PinVal << PinNum));
-				break;
-			}
 
-			case PORTH:
-			{
-				GPIOH -> ODR &= ~(GPIO_1BIT_MASK << PinNum);
-				GPIOH -> ODR |= ((PinVal << PinNum));
-				break;
-			}
 
 
-			default: ErrorState = GPIO_InvalidPortName; break;
 
-		}
+/****************************************************************************************************
+ * 	Decription: This Function is used to write a group of pins of the same port (e.g. a parallel bus)
+ * 				in a single BSRR store: pins in the mask are set or reset, the others are untouched.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- uint16_t Copy_u16Mask: the pins to be written, bit n for pin n.
+ *				- uint16_t Copy_u16Value: the new values of the pins, bit n for pin n.
+ * 	Returns: uint8_t errorState
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pins are Configed usin GPIO_u8PinInit as OUTPUT
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins are set to the values
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+uint8_t GPIO_u8WriteBus(Port_t Port, uint16_t Copy_u16Mask, uint16_t Copy_u16Value)
+{
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
+	if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
+	{
+		/*Masked pins at 1 go to the set half, masked pins at 0 go to the reset half*/
+		GPIO_Ports[Port] -> BSRR = ((uint32_t)(Copy_u16Mask & ~Copy_u16Value) << GPIO_BSRR_RESET_OFFSET) | (Copy_u16Mask & Copy_u16Value);
 	}
 
 	else
 	{
-		ErrorState = GPIO_InvalidPinNum;
+		ErrorState = GPIO_InvalidPortName;
 	}
 
-
 	return ErrorState;
 }
 
@@ -514,41 +429,39 @@ uint8_t GPIO_u8SetPinValue(Port_t Port, Pin_t PinNum, PinVal_t PinVal)
 
 
 /****************************************************************************************************
- * 	Decription: This Function is used to toggle a GPIO pin.
+ * 	Decription: This Function is used to read a group of pins of the same port in a single IDR load.
  * 	Parameters: - port_t Port: is an enum holding the port.
- *				- Pin_t PinNum: is an enum holding the pin number.
+ *				- uint16_t Copy_u16Mask: the pins to be read, bit n for pin n.
+ *				- uint16_t* Copy_pu16Value: is a ptr to recive the masked pins values by reference.
  * 	Returns: uint8_t errorState
  * 	Preconditions: - RCC is initialized and working
  * 				   - Clk enabled for GPIO Peripheral
- *				   - Pin is Configed usin GPIO_u8PinInit as OUTPUT
+ *				   - Pins are Configed usin GPIO_u8PinInit as INPUT
  * 	Side effects: No side effects
- * 	Post Conditions: a GPIO Pin is set to a value
+ * 	Post Conditions: the GPIO Pins are read
  * 	Synch/Asynch: Synch.
  * 	Reentrant/NonReenterant: Re
  ***************************************************************************************************/
-uint8_t GPIO_u8TogglePinValue(Port_t Port, Pin_t PinNum)
+uint8_t GPIO_u8ReadBus(Port_t Port, uint16_t Copy_u16Mask, uint16_t* Copy_pu16Value)
 {
 	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-	if ((PinNum >= 0) && (PinNum <= 15))
+	if (Copy_pu16Value != NULL)
 	{
-		switch(Port)
+		if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
 		{
-			case PORTA: GPIOA -> ODR ^= ((1 << PinNum)); break;
-			case PORTB: GPIOB -> ODR ^= ((1 << PinNum)); break;
-			case PORTC: GPIOC -> ODR ^= ((1 << PinNum)); break;
-			case PORTD: GPIOD -> ODR ^= ((1 << PinNum)); break;
-			case PORTE: GPIOE -> ODR ^= ((1 << PinNum)); break;
-			case PORTF: GPIOF -> ODR ^= ((1 << PinNum)); break;
-			case PORTG: GPIOG -> ODR ^= ((1 << PinNum)); break;
-			case PORTH: GPIOH -> ODR ^= ((1 << PinNum)); break;
-			default: ErrorState = GPIO_InvalidPortName; break;
+			*Copy_pu16Value = (uint16_t)((GPIO_Ports[Port] -> IDR) & Copy_u16Mask);
+		}
+
+		else
+		{
+			ErrorState = GPIO_InvalidPortName;
 		}
 	}
 
 	else
 	{
-		ErrorState = GPIO_InvalidPinNum;
+		ErrorState = GPIO_NullPtr;
 	}
 
 	return ErrorState;
@@ -559,39 +472,87 @@ uint8_t GPIO_u8TogglePinValue(Port_t Port, Pin_t PinNum)
 
 
 /****************************************************************************************************
- * 	Decription: This Function is used to set a GPIO pin.
+ * 	Decription: This Function is used to lock the configs of a group of pins of the same port using the
+ * 				LCKR key sequence, the configs of locked pins can't be changed till the next reset.
+ * 	Parameters: - port_t Port: is an enum holding the port.
+ *				- uint16_t Copy_u16Mask: the pins to be locked, bit n for pin n.
+ * 	Returns: uint8_t errorState: GPIO_LockFailed if the lock is not confirmed, the port LCKR can only be
+ * 				programmed once per reset so the mask must hold all the pins to be locked on this port
+ * 	Preconditions: - RCC is initialized and working
+ * 				   - Clk enabled for GPIO Peripheral
+ *				   - Pins are configed using GPIO_u8PinInit or GPIO_u8PortInit
+ * 	Side effects: No side effects
+ * 	Post Conditions: the GPIO Pins configs are locked
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+uint8_t GPIO_u8LockPins(Port_t Port, uint16_t Copy_u16Mask)
+{
+	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
+	uint32_t Local_u32LCKR;
+
+	if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
+	{
+		GPIO_RegDef_t * Local_pGPIOx = GPIO_Ports[Port];
+		uint32_t Local_u32LockKey = (GPIO_1BIT_MASK << GPIO_LCKR_LCKK);
+
+		/*Key sequence: write 1, write 0, write 1 with the same pins then read twice, LCKR[15:0] must not change in between*/
+		Local_pGPIOx -> LCKR = Local_u32LockKey | Copy_u16Mask;
+		Local_pGPIOx -> LCKR = Copy_u16Mask;
+		Local_pGPIOx -> LCKR = Local_u32LockKey | Copy_u16Mask;
+		Local_u32LCKR = Local_pGPIOx -> LCKR;
+		Local_u32LCKR = Local_pGPIOx -> LCKR;
+
+		/*The lock took effect only if LCKK reads back 1 with all the requested pins*/
+		if (!(((Local_u32LCKR >> GPIO_LCKR_LCKK) & GPIO_1BIT_MASK) && ((Local_u32LCKR & Copy_u16Mask) == Copy_u16Mask)))
+		{
+			ErrorState = GPIO_LockFailed;
+		}
+	}
+
+	else
+	{
+		ErrorState = GPIO_InvalidPortName;
+	}
+
+	return ErrorState;
+}
+
+
+
+
+
+/****************************************************************************************************
+ * 	Decription: This Function is used to check whether a GPIO pin configs are locked.
  * 	Parameters: - port_t Port: is an enum holding the port.
  *				- Pin_t PinNum: is an enum holding the pin number.
- *				- PinVal_t* PinVal: is a ptr to an enum to recive the value by reference.
+ *				- uint8_t* Copy_pu8IsLocked: is a ptr to recive 1 if the pin is locked, 0 if not.
  * 	Returns: uint8_t errorState
  * 	Preconditions: - RCC is initialized and working
  * 				   - Clk enabled for GPIO Peripheral
- *				   - Pin is Configed usin GPIO_u8PinInit as INPUT
  * 	Side effects: No side effects
- * 	Post Conditions: a GPIO Pin is read
+ * 	Post Conditions: the lock state is retrieved
  * 	Synch/Asynch: Synch.
  * 	Reentrant/NonReenterant: Re
  ***************************************************************************************************/
-uint8_t GPIO_u8ReadPinValue(Port_t Port, Pin_t PinNum, PinVal_t* PinVal)
+uint8_t GPIO_u8IsPinLocked(Port_t Port, Pin_t PinNum, uint8_t* Copy_pu8IsLocked)
 {
-
 	GPIOErrorStates_t ErrorState = GPIO_Exit_OK;
 
-	if (PinVal != NULL)
+	if (Copy_pu8IsLocked != NULL)
 	{
-		if ((PinNum >= 0) && (PinNum <= 15))
+		if (MCAL_PARAM_VALID((PinNum >= 0) && (PinNum <= 15)))
 		{
-			switch(Port)
+			if (MCAL_PARAM_VALID(Port < GPIO_PORTS_NUM))
 			{
-				case PORTA: *PinVal = (((GPIOA -> IDR) >> PinNum) & (1)); break;
-				case PORTB: *PinVal = (((GPIOB -> IDR) >> PinNum) & (1)); break;
-				case PORTC: *PinVal = (((GPIOC -> IDR) >> PinNum) & (1)); break;
-				case PORTD: *PinVal = (((GPIOD -> IDR) >> PinNum) & (1)); break;
-				case PORTE: *PinVal = (((GPIOE -> IDR) >> PinNum) & (1)); break;
-				case PORTF: *PinVal = (((GPIOF -> IDR) >> PinNum) & (1)); break;
-				case PORTG: *PinVal = (((GPIOG -> IDR) >> PinNum) & (1)); break;
-				case PORTH: *PinVal = (((GPIOH -> IDR) >> PinNum) & (1)); break;
-				default: ErrorState = GPIO_InvalidPortName; break;
+				uint32_t Local_u32LCKR = GPIO_Ports[Port] -> LCKR;
+
+				*Copy_pu8IsLocked = ((Local_u32LCKR >> GPIO_LCKR_LCKK) & (Local_u32LCKR >> PinNum) & GPIO_1BIT_MASK);
+			}
+
+			else
+			{
+				ErrorState = GPIO_InvalidPortName;
 			}
 		}
 
@@ -607,5 +568,4 @@ uint8_t GPIO_u8ReadPinValue(Port_t Port, Pin_t PinNum, PinVal_t* PinVal)
 	}
 
 	return ErrorState;
-
 }
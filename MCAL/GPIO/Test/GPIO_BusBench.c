@@ -0,0 +1,177 @@
+/***************************************************************************************************
+ * @file: 			GPIO_BusBench.c
+ * @brief: 			Host benchmark of an 8-bit parallel bus on PB0~PB7 over the registers simulation (HOST_SIM):
+ * 					GPIO_u8WriteBus/GPIO_u8ReadBus against one GPIO_u8SetPinValue/GPIO_u8ReadPinValue per bit.
+ * 					Prints the bus accesses per byte & the host bytes/s, every simulated access is trapped so
+ * 					the host rate follows the accesses, it is no target rate. Both write paths are first checked
+ * 					against each other over every byte, non-zero is returned on a mismatch.
+ * 					Build (from the repo root):
+ * 						gcc -std=gnu11 -O2 -DMCAL_HOST_SIM -ILIB -IHOST_SIM/Inc -IMCAL/GPIO/Inc \
+ * 							MCAL/GPIO/Test/GPIO_BusBench.c MCAL/GPIO/Src/GPIO_Prog.c HOST_SIM/Src/HOSTSIM_Prog.c \
+ * 							-o gpio_bus_bench
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "Stm32F446xx.h"
+#include "GPIO_Interface.h"
+#include "HOSTSIM_Interface.h"
+
+
+#define BENCH_BYTES		20000u
+#define BENCH_BUS_MASK	0x00FFu
+
+
+#define BENCH_ODR_FILL	0xC300UL		/*PB8~PB15 pattern the bus writes must leave untouched*/
+
+
+static uint8_t BENCH_u8Sink;
+
+
+
+static void BENCH_vidWritePins(uint8_t Copy_u8Byte)
+{
+	uint8_t Local_u8Bit;
+
+	for(Local_u8Bit = 0; Local_u8Bit < 8u; Local_u8Bit++)
+	{
+		GPIO_u8SetPinValue(PORTB, (Pin_t)Local_u8Bit, (PinVal_t)((Copy_u8Byte >> Local_u8Bit) & 1u));
+	}
+}
+
+
+static void BENCH_vidWriteBus(uint8_t Copy_u8Byte)
+{
+	GPIO_u8WriteBus(PORTB, BENCH_BUS_MASK, Copy_u8Byte);
+}
+
+
+static void BENCH_vidReadPins(uint8_t Copy_u8Byte)
+{
+	PinVal_t Local_Level;
+	uint8_t Local_u8Bit;
+	uint8_t Local_u8Value = 0;
+
+	(void)Copy_u8Byte;
+
+	for(Local_u8Bit = 0; Local_u8Bit < 8u; Local_u8Bit++)
+	{
+		GPIO_u8ReadPinValue(PORTB, (Pin_t)Local_u8Bit, &Local_Level);
+		Local_u8Value |= (uint8_t)(Local_Level << Local_u8Bit);
+	}
+
+	BENCH_u8Sink = Local_u8Value;
+}
+
+
+static void BENCH_vidReadBus(uint8_t Copy_u8Byte)
+{
+	uint16_t Local_u16Value;
+
+	(void)Copy_u8Byte;
+
+	GPIO_u8ReadBus(PORTB, BENCH_BUS_MASK, &Local_u16Value);
+	BENCH_u8Sink = (uint8_t)Local_u16Value;
+}
+
+
+
+/*
+ *
+ * @brief: Writing every byte through both paths from the same ODR, the two ODRs must match & hold the byte
+ *
+ * */
+static uint32_t BENCH_u32CheckWritePaths(void)
+{
+	uint32_t Local_u32Mismatches = 0;
+	uint32_t Local_u32Byte;
+
+	for(Local_u32Byte = 0; Local_u32Byte <= 0xFFu; Local_u32Byte++)
+	{
+		uint32_t Local_u32PinsODR;
+		uint32_t Local_u32BusODR;
+
+		GPIOB -> ODR = BENCH_ODR_FILL | (~Local_u32Byte & BENCH_BUS_MASK);
+		BENCH_vidWritePins((uint8_t)Local_u32Byte);
+		Local_u32PinsODR = GPIOB -> ODR;
+
+		GPIOB -> ODR = BENCH_ODR_FILL | (~Local_u32Byte & BENCH_BUS_MASK);
+		BENCH_vidWriteBus((uint8_t)Local_u32Byte);
+		Local_u32BusODR = GPIOB -> ODR;
+
+		if((Local_u32PinsODR != Local_u32BusODR) || (Local_u32BusODR != (BENCH_ODR_FILL | Local_u32Byte)))
+		{
+			printf("ODR mismatch for %02X: per-pin %04X, bus %04X\n", (unsigned)Local_u32Byte,
+				   (unsigned)Local_u32PinsODR, (unsigned)Local_u32BusODR);
+			Local_u32Mismatches++;
+		}
+	}
+
+	return Local_u32Mismatches;
+}
+
+
+
+/*
+ *
+ * @brief: Moving BENCH_BYTES bytes through a path, printing its bus accesses per byte & host bytes/s
+ *
+ * */
+static void BENCH_vidRun(const char *Copy_pcName, void (*Copy_pFunc)(uint8_t))
+{
+	HOSTSIM_BusStats_t Local_Stats;
+	struct timespec Local_Start, Local_End;
+	uint32_t Local_u32Byte;
+	double Local_Sec;
+
+	HOSTSIM_GetBusStats(&Local_Stats);
+	clock_gettime(CLOCK_MONOTONIC, &Local_Start);
+
+	for(Local_u32Byte = 0; Local_u32Byte < BENCH_BYTES; Local_u32Byte++)
+	{
+		Copy_pFunc((uint8_t)Local_u32Byte);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &Local_End);
+	HOSTSIM_GetBusStats(&Local_Stats);
+
+	Local_Sec = (double)(Local_End.tv_sec - Local_Start.tv_sec) + ((double)(Local_End.tv_nsec - Local_Start.tv_nsec) * 1e-9);
+
+	printf("%-14s %8.2f %8.2f %12.0f\n", Copy_pcName, (double)Local_Stats.Reads / BENCH_BYTES,
+		   (double)Local_Stats.Writes / BENCH_BYTES, BENCH_BYTES / Local_Sec);
+}
+
+
+
+int main(void)
+{
+	PinConfig_t Local_Bus[8];
+	uint8_t Local_u8Pin;
+	uint32_t Local_u32Mismatches;
+
+	HOSTSIM_Init();
+
+	for(Local_u8Pin = 0; Local_u8Pin < 8u; Local_u8Pin++)
+	{
+		Local_Bus[Local_u8Pin] = (PinConfig_t){.Port = PORTB, .PinNum = (Pin_t)Local_u8Pin, .Mode = OUTPUT};
+	}
+
+	GPIO_u8PortInit(Local_Bus, 8u);
+
+	/*Both write paths must leave the same ODR*/
+	Local_u32Mismatches = BENCH_u32CheckWritePaths();
+	printf("ODR check over 00~FF: %s (%u mismatches)\n\n", Local_u32Mismatches ? "FAILED" : "OK", (unsigned)Local_u32Mismatches);
+
+	printf("%-14s %8s %8s %12s\n", "path", "reads/B", "writes/B", "host B/s");
+
+	BENCH_vidRun("Write per-pin", BENCH_vidWritePins);
+	BENCH_vidRun("WriteBus", BENCH_vidWriteBus);
+	BENCH_vidRun("Read per-pin", BENCH_vidReadPins);
+	BENCH_vidRun("ReadBus", BENCH_vidReadBus);
+
+	return (Local_u32Mismatches != 0u);
+}
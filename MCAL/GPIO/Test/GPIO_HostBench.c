@@ -0,0 +1,90 @@
+/***************************************************************************************************
+ * @file: 			GPIO_HostBench.c
+ * @brief: 			Host benchmark of the GPIO pin paths on the registers simulation (HOST_SIM): bus accesses
+ * 					per call & host time per call. Every simulated access is trapped, so the host time follows
+ * 					the bus accesses, it is no target cycle count. Any GPIO_Prog.c revision can be linked to
+ * 					compare builds, e.g. one taken with git show <rev>:MCAL/GPIO/Src/GPIO_Prog.c
+ * 					Build (from the repo root):
+ * 						gcc -std=gnu11 -O2 -DMCAL_HOST_SIM -ILIB -IHOST_SIM/Inc -IMCAL/GPIO/Inc \
+ * 							MCAL/GPIO/Test/GPIO_HostBench.c MCAL/GPIO/Src/GPIO_Prog.c HOST_SIM/Src/HOSTSIM_Prog.c \
+ * 							-o gpio_bench
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "Stm32F446xx.h"
+#include "GPIO_Interface.h"
+#include "HOSTSIM_Interface.h"
+
+
+#define BENCH_CALLS		20000u
+
+
+static PinConfig_t BENCH_Pin = {.Port = PORTC, .PinNum = PIN15, .Mode = OUTPUT, .OutputType = PUSH_PULL, .Speed = LOW_SPEED, .PullType = NO_PULL};
+static PinVal_t BENCH_Level;
+
+
+
+static void BENCH_vidPinInit(uint32_t Copy_u32Call)	{ (void)Copy_u32Call; GPIO_u8PinInit(&BENCH_Pin); }
+static void BENCH_vidSet(uint32_t Copy_u32Call)		{ (void)Copy_u32Call; GPIO_u8SetPinValue(PORTC, PIN15, HIGH); }
+static void BENCH_vidReset(uint32_t Copy_u32Call)	{ (void)Copy_u32Call; GPIO_u8SetPinValue(PORTC, PIN15, LOW); }
+static void BENCH_vidToggle(uint32_t Copy_u32Call)	{ (void)Copy_u32Call; GPIO_u8TogglePinValue(PORTC, PIN15); }
+static void BENCH_vidRead(uint32_t Copy_u32Call)	{ (void)Copy_u32Call; GPIO_u8ReadPinValue(PORTC, PIN15, &BENCH_Level); }
+
+/*The ports dispatch: the same path swept over PORTA ~ PORTH, its cost must not depend on the port*/
+static void BENCH_vidSetPorts(uint32_t Copy_u32Call)	{ GPIO_u8SetPinValue((Port_t)(Copy_u32Call % 8u), PIN15, HIGH); }
+static void BENCH_vidSetPortH(uint32_t Copy_u32Call)	{ (void)Copy_u32Call; GPIO_u8SetPinValue(PORTH, PIN15, HIGH); }
+
+
+
+/*
+ *
+ * @brief: Running a path BENCH_CALLS times, printing its bus accesses & host time per call
+ *
+ * */
+static void BENCH_vidRun(const char *Copy_pcName, void (*Copy_pFunc)(uint32_t))
+{
+	HOSTSIM_BusStats_t Local_Stats;
+	struct timespec Local_Start, Local_End;
+	uint32_t Local_u32Call;
+	double Local_Ns;
+
+	HOSTSIM_GetBusStats(&Local_Stats);
+	clock_gettime(CLOCK_MONOTONIC, &Local_Start);
+
+	for(Local_u32Call = 0; Local_u32Call < BENCH_CALLS; Local_u32Call++)
+	{
+		Copy_pFunc(Local_u32Call);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &Local_End);
+	HOSTSIM_GetBusStats(&Local_Stats);
+
+	Local_Ns = ((double)(Local_End.tv_sec - Local_Start.tv_sec) * 1e9) + (double)(Local_End.tv_nsec - Local_Start.tv_nsec);
+
+	printf("%-14s %8.2f %8.2f %10.0f\n", Copy_pcName, (double)Local_Stats.Reads / BENCH_CALLS,
+		   (double)Local_Stats.Writes / BENCH_CALLS, Local_Ns / BENCH_CALLS);
+}
+
+
+
+int main(void)
+{
+	HOSTSIM_Init();
+
+	printf("%-14s %8s %8s %10s\n", "path", "reads", "writes", "host ns");
+
+	BENCH_vidRun("PinInit", BENCH_vidPinInit);
+	BENCH_vidRun("Set HIGH", BENCH_vidSet);
+	BENCH_vidRun("Set LOW", BENCH_vidReset);
+	BENCH_vidRun("Toggle", BENCH_vidToggle);
+	BENCH_vidRun("Read", BENCH_vidRead);
+	BENCH_vidRun("Set A~H", BENCH_vidSetPorts);
+	BENCH_vidRun("Set H", BENCH_vidSetPortH);
+
+	return 0;
+}
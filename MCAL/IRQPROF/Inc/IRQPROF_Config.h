@@ -0,0 +1,20 @@
+/***************************************************************************************************
+ * @file: 			IRQPROF_Config.h
+ * @brief: 			This file contains the build configs of the IRQs profiler
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef IRQPROF_CONFIG_H
+#define IRQPROF_CONFIG_H
+
+
+
+/*Timestamp of the handlers entries & exits, any free-running uint32_t counter. The DWT cycle counter by default (DWT_Init() must be called)*/
+#ifndef IRQPROF_TIMESTAMP
+#define IRQPROF_TIMESTAMP()			(DWT -> CYCCNT)
+#endif
+
+
+
+#endif
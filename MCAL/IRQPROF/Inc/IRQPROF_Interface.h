@@ -0,0 +1,189 @@
+/***************************************************************************************************
+ * @file: 			IRQPROF_Interface.h
+ * @brief: 			This file contains the interfaces & func prototypes of the IRQs profiler: the profiled IRQs
+ * 					are dispatched through a wrapper from the SRAM vector table which accounts their cycles, the
+ * 					lines of the EXTI shared handlers are accounted by the EXTI driver (EXTI_PROFILING)
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef IRQPROF_INTERFACE_H
+#define IRQPROF_INTERFACE_H
+
+
+									/******************		Interfacing Enums		****************/
+/*Error State enum as a return values of the profiler funcs*/
+typedef enum
+{
+	IRQPROF_Exit_OK,
+	IRQPROF_NULL_Ptr_Err,
+	IRQPROF_InvalidIRQ,
+	IRQPROF_InvalidLine,
+	IRQPROF_NotRelocated,
+	IRQPROF_BufferTooSmall
+
+}IRQPROF_ErrorStates_t;
+
+
+
+										/******************		Interfacing Structs		****************/
+/*The accounting of an IRQ or an EXTI line, the cycles exclude the nested handlers that preempted it*/
+typedef struct
+{
+	uint32_t Count;						/*Handler runs*/
+	uint64_t TotalCycles;
+	uint32_t MaxCycles;
+	uint8_t MaxDepth;					/*Deepest nesting it ran at, 1 when it never preempted a handler*/
+
+}IRQPROF_Stats_t;
+
+
+/*A line accounting state, a local of the EXTI handler from IRQPROF_LineBegin() to IRQPROF_LineEnd()*/
+typedef struct
+{
+	uint32_t Stamp;
+	uint32_t Nested;					/*Cycles of the handlers nested at the begin*/
+
+}IRQPROF_LineFrame_t;
+
+
+
+										/******************		Function Prototypes		****************/
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to init the profiler: the stats are cleared and the core clk is
+ * 								kept for the dumps
+ * 	Parameters:                 - uint32_t Copy_u32CoreClkHz: the core (HCLK) clk, as given to DWT_Init()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The profiler is ready, no IRQ is attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void IRQPROF_Init(uint32_t Copy_u32CoreClkHz);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to profile an IRQ: its vector is swapped for the profiler wrapper
+ * 								which times the original handler, found through IPSR
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ to profile
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC_RelocateVectorTable() must be called first, the handler changes go through
+ * 								   NVIC_SetVector() before the attach or after the detach
+ * 	Side effects:               A few cycles are added to each run of the IRQ
+ * 	Post Conditions:            The IRQ is profiled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Attach(NVIC_IRQs_t Copy_u8IRQNum);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to stop profiling an IRQ, its original handler is put back
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ profiled
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC_RelocateVectorTable() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The IRQ is no more profiled, its stats are kept
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Detach(NVIC_IRQs_t Copy_u8IRQNum);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to start the accounting of an EXTI line in a shared handler
+ * 	Parameters:                 - IRQPROF_LineFrame_t *Copy_pFrame: the line state, passed to IRQPROF_LineEnd()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called by the EXTI driver built with EXTI_PROFILING on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line is being timed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+void IRQPROF_LineBegin(IRQPROF_LineFrame_t *Copy_pFrame);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to end the accounting of an EXTI line in a shared handler
+ * 	Parameters:                 - uint8_t Copy_u8Line: the line dispatched
+ * 								- const IRQPROF_LineFrame_t *Copy_pFrame: the state filled by IRQPROF_LineBegin()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called by the EXTI driver built with EXTI_PROFILING on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line stats are updated
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+void IRQPROF_LineEnd(uint8_t Copy_u8Line, const IRQPROF_LineFrame_t *Copy_pFrame);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the stats of an IRQ
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ profiled
+ * 								- IRQPROF_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved, a run ending meanwhile may give a torn copy
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_GetIRQStats(NVIC_IRQs_t Copy_u8IRQNum, IRQPROF_Stats_t *Copy_pStats);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the stats of an EXTI line of the shared handlers
+ * 	Parameters:                 - uint8_t Copy_u8Line: the EXTI line 0 ~ 22
+ * 								- IRQPROF_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_PROFILING is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved, MaxDepth is 0 while the shared IRQ isn't attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_GetLineStats(uint8_t Copy_u8Line, IRQPROF_Stats_t *Copy_pStats);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the stats of all the IRQs & lines
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are zeroed, the attached IRQs stay attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void IRQPROF_Reset(void);
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to dump the stats as a compact binary table (format in IRQPROF_Prv.h),
+ * 								decoded on the host by TOOLS/IRQPROF_Decode
+ * 	Parameters:                 - uint8_t *Copy_pu8Buffer: the dump buffer
+ * 								- uint32_t Copy_u32Size: its size in bytes
+ * 								- uint32_t *Copy_pu32Written: used to store the dump size, the size needed when
+ * 								  the buffer is too small
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  IRQPROF_Init()
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The dump is written, 12 bytes + 18 per IRQ & line that ran
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Dump(uint8_t *Copy_pu8Buffer, uint32_t Copy_u32Size, uint32_t *Copy_pu32Written);
+
+
+
+#endif
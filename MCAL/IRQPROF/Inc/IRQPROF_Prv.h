@@ -0,0 +1,39 @@
+/***************************************************************************************************
+ * @file: 			IRQPROF_Prv.h
+ * @brief: 			This file contains the private definitions of the IRQs profiler
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#ifndef IRQPROF_PRV_H
+#define IRQPROF_PRV_H
+
+#define NULL ((void *)0)
+
+
+/*STM32F446RE: IRQ0 ~ IRQ96 & the 23 EXTI lines*/
+#define IRQPROF_IRQS_NUM			97u
+#define IRQPROF_LINES_NUM			23u
+
+/*IPSR of IRQ n: 16 + n*/
+#define IRQPROF_SYSTEM_VECTORS_NUM	16u
+
+/*4 priority bits: at most 16 nested handlers, slot 0 is the thread mode*/
+#define IRQPROF_MAX_DEPTH			16u
+
+
+/******************* Dump Format *******************/
+/*
+ * Little endian, no padding:
+ * 		Header:		'I' 'R' 'Q' 'P', version (u8), IRQs records (u8), lines records (u8), reserved (u8), core clk Hz (u32)
+ * 		Records:	id (u8), max depth (u8), count (u32), total cycles (u64), max cycles (u32)
+ * the IRQs records first then the lines ones, only the sources that ran are dumped.
+ */
+#define IRQPROF_DUMP_MAGIC			"IRQP"
+#define IRQPROF_DUMP_VERSION		1u
+#define IRQPROF_DUMP_HEADER_SIZE	12u
+#define IRQPROF_DUMP_RECORD_SIZE	18u
+
+
+
+#endif
@@ -0,0 +1,500 @@
+/***************************************************************************************************
+ * @file: 			IRQPROF_Prog.c
+ * @brief: 			This file contains the implementation of the IRQs profiler
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdint.h>
+
+#include "Stm32F446xx.h"
+#include "CortexM4_Core.h"
+#include "MCAL_Config.h"
+
+#include "NVIC_Interface.h"
+
+#include "IRQPROF_Config.h"
+#include "IRQPROF_Prv.h"
+#include "IRQPROF_Interface.h"
+
+
+/*
+ *
+ * @brief: The original handlers of the attached IRQs, NULL for the others
+ *
+ * */
+static NVIC_Handler_t IRQPROF_Handlers[IRQPROF_IRQS_NUM] = {NULL};
+
+
+
+/*
+ *
+ * @brief: The stats, each entry is only updated by the handler of its own IRQ (or line) which can't preempt itself
+ *
+ * */
+static volatile IRQPROF_Stats_t IRQPROF_IRQStats[IRQPROF_IRQS_NUM];
+static volatile IRQPROF_Stats_t IRQPROF_LineStats[IRQPROF_LINES_NUM];
+
+
+
+/*
+ *
+ * @brief: The nesting of the profiled handlers: the depth & the cycles of the handlers nested at each depth, the
+ * 		   handlers nest strictly so the depth is back to its value before any preempted instruction resumes
+ *
+ * */
+static volatile uint8_t IRQPROF_u8Depth = 0;
+static volatile uint32_t IRQPROF_Nested[IRQPROF_MAX_DEPTH + 1u];
+
+
+
+/*
+ *
+ * @brief: The core clk of the dumps, given to IRQPROF_Init
+ *
+ * */
+static uint32_t IRQPROF_u32CoreClkHz = 0;
+
+
+
+/*
+ *
+ * @brief: Accounting a run of an IRQ or a line
+ *
+ * */
+static void IRQPROF_vidAccount(volatile IRQPROF_Stats_t *Copy_pStats, uint32_t Copy_u32Cycles, uint8_t Copy_u8Depth)
+{
+	Copy_pStats -> Count++;
+	Copy_pStats -> TotalCycles += Copy_u32Cycles;
+
+	if(Copy_u32Cycles > (Copy_pStats -> MaxCycles))
+	{
+		Copy_pStats -> MaxCycles = Copy_u32Cycles;
+	}
+
+	if(Copy_u8Depth > (Copy_pStats -> MaxDepth))
+	{
+		Copy_pStats -> MaxDepth = Copy_u8Depth;
+	}
+}
+
+
+
+/*
+ *
+ * @brief: The vector of the attached IRQs: times the original handler found from IPSR, without the cycles of the
+ * 		   handlers nested in it which are added to the depth below instead
+ *
+ * */
+static void IRQPROF_vidWrapper(void)
+{
+	uint8_t Local_u8IRQ = (uint8_t)(CORE_GET_IPSR() - IRQPROF_SYSTEM_VECTORS_NUM);
+	uint8_t Local_u8Depth = IRQPROF_u8Depth + 1u;
+	uint32_t Local_u32Start;
+	uint32_t Local_u32Cycles;
+	uint32_t Local_u32Exclusive;
+
+	IRQPROF_u8Depth = Local_u8Depth;
+	IRQPROF_Nested[Local_u8Depth] = 0;
+	Local_u32Start = IRQPROF_TIMESTAMP();
+
+	if(IRQPROF_Handlers[Local_u8IRQ] != NULL)
+	{
+		IRQPROF_Handlers[Local_u8IRQ]();
+	}
+
+	Local_u32Cycles = IRQPROF_TIMESTAMP() - Local_u32Start;
+	Local_u32Exclusive = Local_u32Cycles - IRQPROF_Nested[Local_u8Depth];
+
+	IRQPROF_vidAccount(&IRQPROF_IRQStats[Local_u8IRQ], Local_u32Exclusive, Local_u8Depth);
+
+	/*The depth is restored last: a handler preempting before it reuses a deeper slot, not this one*/
+	IRQPROF_Nested[Local_u8Depth - 1u] += Local_u32Cycles;
+	IRQPROF_u8Depth = Local_u8Depth - 1u;
+}
+
+
+
+/*
+ *
+ * @brief: Writing a little endian field of a dump record, returns the next byte
+ *
+ * */
+static uint8_t * IRQPROF_pu8Put(uint8_t *Copy_pu8Dest, uint64_t Copy_u64Value, uint8_t Copy_u8Bytes)
+{
+	uint8_t Local_u8Byte;
+
+	for(Local_u8Byte = 0; Local_u8Byte < Copy_u8Bytes; Local_u8Byte++)
+	{
+		Copy_pu8Dest[Local_u8Byte] = (uint8_t)(Copy_u64Value >> (Local_u8Byte * 8u));
+	}
+
+	return Copy_pu8Dest + Copy_u8Bytes;
+}
+
+
+
+/*
+ *
+ * @brief: Writing the records of the sources that ran, at most the records counted in the header, returns the next byte
+ *
+ * */
+static uint8_t * IRQPROF_pu8PutRecords(uint8_t *Copy_pu8Dest, const volatile IRQPROF_Stats_t *Copy_pStats, uint8_t Copy_u8Num, uint8_t Copy_u8Records)
+{
+	uint8_t Local_u8Id;
+
+	for(Local_u8Id = 0; (Local_u8Id < Copy_u8Num) && (Copy_u8Records != 0u); Local_u8Id++)
+	{
+		if(Copy_pStats[Local_u8Id].Count != 0u)
+		{
+			Copy_u8Records--;
+
+			Copy_pu8Dest = IRQPROF_pu8Put(Copy_pu8Dest, Local_u8Id, 1u);
+			Copy_pu8Dest = IRQPROF_pu8Put(Copy_pu8Dest, Copy_pStats[Local_u8Id].MaxDepth, 1u);
+			Copy_pu8Dest = IRQPROF_pu8Put(Copy_pu8Dest, Copy_pStats[Local_u8Id].Count, 4u);
+			Copy_pu8Dest = IRQPROF_pu8Put(Copy_pu8Dest, Copy_pStats[Local_u8Id].TotalCycles, 8u);
+			Copy_pu8Dest = IRQPROF_pu8Put(Copy_pu8Dest, Copy_pStats[Local_u8Id].MaxCycles, 4u);
+		}
+	}
+
+	return Copy_pu8Dest;
+}
+
+
+
+/*
+ *
+ * @brief: Counting the sources that ran
+ *
+ * */
+static uint8_t IRQPROF_u8CountRan(const volatile IRQPROF_Stats_t *Copy_pStats, uint8_t Copy_u8Num)
+{
+	uint8_t Local_u8Id;
+	uint8_t Local_u8Ran = 0;
+
+	for(Local_u8Id = 0; Local_u8Id < Copy_u8Num; Local_u8Id++)
+	{
+		if(Copy_pStats[Local_u8Id].Count != 0u)
+		{
+			Local_u8Ran++;
+		}
+	}
+
+	return Local_u8Ran;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to init the profiler: the stats are cleared and the core clk is
+ * 								kept for the dumps
+ * 	Parameters:                 - uint32_t Copy_u32CoreClkHz: the core (HCLK) clk, as given to DWT_Init()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  DWT_Init() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The profiler is ready, no IRQ is attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void IRQPROF_Init(uint32_t Copy_u32CoreClkHz)
+{
+	uint8_t Local_u8IRQ;
+
+	for(Local_u8IRQ = 0; Local_u8IRQ < IRQPROF_IRQS_NUM; Local_u8IRQ++)
+	{
+		IRQPROF_Handlers[Local_u8IRQ] = NULL;
+	}
+
+	IRQPROF_u32CoreClkHz = Copy_u32CoreClkHz;
+	IRQPROF_Reset();
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to profile an IRQ: its vector is swapped for the profiler wrapper
+ * 								which times the original handler, found through IPSR
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ to profile
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC_RelocateVectorTable() must be called first, the handler changes go through
+ * 								   NVIC_SetVector() before the attach or after the detach
+ * 	Side effects:               A few cycles are added to each run of the IRQ
+ * 	Post Conditions:            The IRQ is profiled
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Attach(NVIC_IRQs_t Copy_u8IRQNum)
+{
+	IRQPROF_ErrorStates_t Local_u8ErrorState = IRQPROF_Exit_OK;
+	NVIC_Handler_t Local_pHandler;
+
+	if(MCAL_PARAM_VALID(Copy_u8IRQNum < IRQPROF_IRQS_NUM))
+	{
+		if(NVIC_GetVector(Copy_u8IRQNum, &Local_pHandler) == NVIVC_Exit_Ok)
+		{
+			/*The original is kept before the wrapper can be fetched, attaching twice keeps it*/
+			if(Local_pHandler != IRQPROF_vidWrapper)
+			{
+				IRQPROF_Handlers[Copy_u8IRQNum] = Local_pHandler;
+				NVIC_SetVector(Copy_u8IRQNum, IRQPROF_vidWrapper);
+			}
+		}
+		else
+		{
+			Local_u8ErrorState = IRQPROF_NotRelocated;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = IRQPROF_InvalidIRQ;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to stop profiling an IRQ, its original handler is put back
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ profiled
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  NVIC_RelocateVectorTable() must be called first
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The IRQ is no more profiled, its stats are kept
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Detach(NVIC_IRQs_t Copy_u8IRQNum)
+{
+	IRQPROF_ErrorStates_t Local_u8ErrorState = IRQPROF_Exit_OK;
+	NVIC_Handler_t Local_pHandler;
+
+	if(MCAL_PARAM_VALID(Copy_u8IRQNum < IRQPROF_IRQS_NUM))
+	{
+		if(NVIC_GetVector(Copy_u8IRQNum, &Local_pHandler) == NVIVC_Exit_Ok)
+		{
+			if((Local_pHandler == IRQPROF_vidWrapper) && (IRQPROF_Handlers[Copy_u8IRQNum] != NULL))
+			{
+				NVIC_SetVector(Copy_u8IRQNum, IRQPROF_Handlers[Copy_u8IRQNum]);
+			}
+		}
+		else
+		{
+			Local_u8ErrorState = IRQPROF_NotRelocated;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = IRQPROF_InvalidIRQ;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to start the accounting of an EXTI line in a shared handler
+ * 	Parameters:                 - IRQPROF_LineFrame_t *Copy_pFrame: the line state, passed to IRQPROF_LineEnd()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called by the EXTI driver built with EXTI_PROFILING on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line is being timed
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+void IRQPROF_LineBegin(IRQPROF_LineFrame_t *Copy_pFrame)
+{
+	Copy_pFrame -> Nested = IRQPROF_Nested[IRQPROF_u8Depth];
+	Copy_pFrame -> Stamp = IRQPROF_TIMESTAMP();
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to end the accounting of an EXTI line in a shared handler
+ * 	Parameters:                 - uint8_t Copy_u8Line: the line dispatched
+ * 								- const IRQPROF_LineFrame_t *Copy_pFrame: the state filled by IRQPROF_LineBegin()
+ * 	Returns:                    - None
+ * 	Preconditions:              -  Called by the EXTI driver built with EXTI_PROFILING on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The line stats are updated
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Re
+ *************************************************************************************************************/
+void IRQPROF_LineEnd(uint8_t Copy_u8Line, const IRQPROF_LineFrame_t *Copy_pFrame)
+{
+	uint32_t Local_u32Cycles = IRQPROF_TIMESTAMP() - (Copy_pFrame -> Stamp);
+	uint8_t Local_u8Depth = IRQPROF_u8Depth;
+
+	if(Copy_u8Line < IRQPROF_LINES_NUM)
+	{
+		IRQPROF_vidAccount(&IRQPROF_LineStats[Copy_u8Line], Local_u32Cycles - (IRQPROF_Nested[Local_u8Depth] - (Copy_pFrame -> Nested)), Local_u8Depth);
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the stats of an IRQ
+ * 	Parameters:                 - NVIC_IRQs_t Copy_u8IRQNum: the IRQ profiled
+ * 								- IRQPROF_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved, a run ending meanwhile may give a torn copy
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_GetIRQStats(NVIC_IRQs_t Copy_u8IRQNum, IRQPROF_Stats_t *Copy_pStats)
+{
+	IRQPROF_ErrorStates_t Local_u8ErrorState = IRQPROF_Exit_OK;
+
+	if(Copy_pStats != NULL)
+	{
+		if(MCAL_PARAM_VALID(Copy_u8IRQNum < IRQPROF_IRQS_NUM))
+		{
+			*Copy_pStats = IRQPROF_IRQStats[Copy_u8IRQNum];
+		}
+		else
+		{
+			Local_u8ErrorState = IRQPROF_InvalidIRQ;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = IRQPROF_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to get the stats of an EXTI line of the shared handlers
+ * 	Parameters:                 - uint8_t Copy_u8Line: the EXTI line 0 ~ 22
+ * 								- IRQPROF_Stats_t *Copy_pStats: ptr to receive the stats
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  EXTI_PROFILING is on
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are retrieved, MaxDepth is 0 while the shared IRQ isn't attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_GetLineStats(uint8_t Copy_u8Line, IRQPROF_Stats_t *Copy_pStats)
+{
+	IRQPROF_ErrorStates_t Local_u8ErrorState = IRQPROF_Exit_OK;
+
+	if(Copy_pStats != NULL)
+	{
+		if(MCAL_PARAM_VALID(Copy_u8Line < IRQPROF_LINES_NUM))
+		{
+			*Copy_pStats = IRQPROF_LineStats[Copy_u8Line];
+		}
+		else
+		{
+			Local_u8ErrorState = IRQPROF_InvalidLine;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = IRQPROF_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to clear the stats of all the IRQs & lines
+ * 	Parameters:                 - None
+ * 	Returns:                    - None
+ * 	Preconditions:              -  None
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The stats are zeroed, the attached IRQs stay attached
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+void IRQPROF_Reset(void)
+{
+	uint8_t Local_u8Id;
+
+	for(Local_u8Id = 0; Local_u8Id < IRQPROF_IRQS_NUM; Local_u8Id++)
+	{
+		IRQPROF_IRQStats[Local_u8Id].Count = 0u;
+		IRQPROF_IRQStats[Local_u8Id].TotalCycles = 0u;
+		IRQPROF_IRQStats[Local_u8Id].MaxCycles = 0u;
+		IRQPROF_IRQStats[Local_u8Id].MaxDepth = 0u;
+	}
+
+	for(Local_u8Id = 0; Local_u8Id < IRQPROF_LINES_NUM; Local_u8Id++)
+	{
+		IRQPROF_LineStats[Local_u8Id].Count = 0u;
+		IRQPROF_LineStats[Local_u8Id].TotalCycles = 0u;
+		IRQPROF_LineStats[Local_u8Id].MaxCycles = 0u;
+		IRQPROF_LineStats[Local_u8Id].MaxDepth = 0u;
+	}
+}
+
+
+
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to dump the stats as a compact binary table (format in IRQPROF_Prv.h),
+ * 								decoded on the host by TOOLS/IRQPROF_Decode
+ * 	Parameters:                 - uint8_t *Copy_pu8Buffer: the dump buffer
+ * 								- uint32_t Copy_u32Size: its size in bytes
+ * 								- uint32_t *Copy_pu32Written: used to store the dump size, the size needed when
+ * 								  the buffer is too small
+ * 	Returns:                    - IRQPROF_ErrorStates_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  IRQPROF_Init()
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            The dump is written, 12 bytes + 18 per IRQ & line that ran
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+IRQPROF_ErrorStates_t IRQPROF_Dump(uint8_t *Copy_pu8Buffer, uint32_t Copy_u32Size, uint32_t *Copy_pu32Written)
+{
+	IRQPROF_ErrorStates_t Local_u8ErrorState = IRQPROF_Exit_OK;
+
+	if((Copy_pu8Buffer != NULL) && (Copy_pu32Written != NULL))
+	{
+		uint8_t Local_u8IRQsRan = IRQPROF_u8CountRan(IRQPROF_IRQStats, IRQPROF_IRQS_NUM);
+		uint8_t Local_u8LinesRan = IRQPROF_u8CountRan(IRQPROF_LineStats, IRQPROF_LINES_NUM);
+		uint32_t Local_u32Size = IRQPROF_DUMP_HEADER_SIZE + ((uint32_t)(Local_u8IRQsRan + Local_u8LinesRan) * IRQPROF_DUMP_RECORD_SIZE);
+
+		*Copy_pu32Written = Local_u32Size;
+
+		if(Copy_u32Size >= Local_u32Size)
+		{
+			uint8_t *Local_pu8Dest = Copy_pu8Buffer;
+			uint8_t Local_u8Byte;
+
+			for(Local_u8Byte = 0; Local_u8Byte < 4u; Local_u8Byte++)
+			{
+				Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, (uint8_t)IRQPROF_DUMP_MAGIC[Local_u8Byte], 1u);
+			}
+
+			Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, IRQPROF_DUMP_VERSION, 1u);
+			Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, Local_u8IRQsRan, 1u);
+			Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, Local_u8LinesRan, 1u);
+			Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, 0u, 1u);
+			Local_pu8Dest = IRQPROF_pu8Put(Local_pu8Dest, IRQPROF_u32CoreClkHz, 4u);
+
+			/*Capped to the header counts: a source running for the first time meanwhile can't overflow the buffer*/
+			Local_pu8Dest = IRQPROF_pu8PutRecords(Local_pu8Dest, IRQPROF_IRQStats, IRQPROF_IRQS_NUM, Local_u8IRQsRan);
+			IRQPROF_pu8PutRecords(Local_pu8Dest, IRQPROF_LineStats, IRQPROF_LINES_NUM, Local_u8LinesRan);
+		}
+		else
+		{
+			Local_u8ErrorState = IRQPROF_BufferTooSmall;
+		}
+	}
+	else
+	{
+		Local_u8ErrorState = IRQPROF_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
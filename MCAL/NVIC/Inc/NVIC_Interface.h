@@ -14,11 +14,17 @@ typedef enum
 	NVIVC_Exit_Ok,
 	NVIC_Invalid_IRQ,
 	NVIC_NULL_PTR,
-	NVIC_Invalid_Priority
+	NVIC_Invalid_Priority,
+	NVIC_VectorTable_NotRelocated,
+	NVIC_Invalid_PriGroup
 
 }NVIC_ErrorState_t;
 
 
+/*An exception handler, as stored in the vector table*/
+typedef void (*NVIC_Handler_t)(void);
+
+
 typedef enum
 {
 	NVIC_ActvFlag_Set,
@@ -122,6 +128,24 @@ typedef enum
 
 
 
+/*Words of an IRQs mask, bit n of word n / 32 for IRQ n*/
+#define NVIC_IRQ_MASK_WORDS		4u
+
+/*Adds an IRQ to a mask of NVIC_IRQ_MASK_WORDS words*/
+#define NVIC_IRQ_MASK_ADD(MASK, IRQ)	((MASK)[(IRQ) / 32u] |= (1UL << ((IRQ) % 32u)))
+
+
+/*An entry of the system priority table*/
+typedef struct
+{
+	NVIC_IRQs_t IRQ;
+	uint8_t Preempt;			/*Preempt (group) priority, 0 is the highest*/
+	uint8_t Sub;				/*Sub priority among the same preempt priority*/
+
+}NVIC_PriorityEntry_t;
+
+
+
 /****************************************************************************************************
  * 	@brief		 This Function is used to enable the interrupt of a given source.
  * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
@@ -153,6 +177,7 @@ NVIC_ErrorState_t NVIC_DisableIRQ(NVIC_IRQs_t Copy_u8IRQNum);
 /****************************************************************************************************
  * 	@brief		 This Function is used to set the priority of the interrupt of a given source.
  * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t Copy_u8Priority: the priority 0 ~ 15, clamped to 15 (lowest) when the checks are off.
  * 	@return 	 NVIC_ErrorState_t: return errorState
  * 	@pre		 perfable SCB_SetPriGroup is used to set the config type of this priority(group vs sub)
 
@@ -207,4 +232,250 @@ NVIC_ErrorState_t NVIC_ClearPendingFlag(NVIC_IRQs_t Copy_u8IRQNum);
 NVIC_ErrorState_t NVIC_GetActiveFlag(NVIC_IRQs_t Copy_u8IRQNum, NVIC_ActvFlag_t* Copy_u8ActvFlgStat);
 
 
+/****************************************************************************************************
+ * 	@brief		 This Function is used to copy the active vector table (flash at reset) to an SRAM table and
+ * 				 point SCB VTOR at it, so the handlers can be installed at runtime by NVIC_SetVector.
+ * 	@param 		 None
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 Called once at startup, before any NVIC_SetVector
+
+ * 	@post 		 The exceptions are fetched from the SRAM table
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_RelocateVectorTable(void);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to install the handler of a given source directly in the vector table,
+ * 				 the core then jumps to it with no driver wrapper in between.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 NVIC_Handler_t Copy_pHandler: the handler, it clears its peripheral flag (e.g. EXTI PR) itself.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 NVIC_RelocateVectorTable is called
+
+ * 	@post 		 The next exception of this src runs the handler
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetVector(NVIC_IRQs_t Copy_u8IRQNum, NVIC_Handler_t Copy_pHandler);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get the handler installed for a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 NVIC_Handler_t* Copy_pHandler: used to store the handler.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 NVIC_RelocateVectorTable is called
+
+ * 	@post 		 The handler is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetVector(NVIC_IRQs_t Copy_u8IRQNum, NVIC_Handler_t* Copy_pHandler);
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to encode a (preempt, sub) priority pair for a PRIGROUP into the value
+ * 				 taken by NVIC_SetPriority: with 4 implemented bits, (7 - PRIGROUP) of them are preempt bits
+ * 				 (at most 4), the remaining ones are sub bits.
+ * 	@param 		 uint8_t Copy_u8PriGroup: the AIRCR PRIGROUP 0 ~ 7 (SCB_GetPriorityGroup).
+ * 				 uint8_t Copy_u8Preempt: the preempt (group) priority, 0 is the highest.
+ * 				 uint8_t Copy_u8Sub: the sub priority, orders the pending IRQs of the same preempt priority.
+ * 				 uint8_t* Copy_pu8Priority: used to store the encoded priority 0 ~ 15.
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_Priority if a level doesn't fit its bits
+ * 	@pre		 None
+
+ * 	@post 		 The priority is encoded
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_EncodePriority(uint8_t Copy_u8PriGroup, uint8_t Copy_u8Preempt, uint8_t Copy_u8Sub, uint8_t* Copy_pu8Priority);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to decode a priority 0 ~ 15 into its (preempt, sub) pair for a PRIGROUP.
+ * 	@param 		 uint8_t Copy_u8PriGroup: the AIRCR PRIGROUP 0 ~ 7 (SCB_GetPriorityGroup).
+ * 				 uint8_t Copy_u8Priority: the priority as set by NVIC_SetPriority.
+ * 				 uint8_t* Copy_pu8Preempt: used to store the preempt priority.
+ * 				 uint8_t* Copy_pu8Sub: used to store the sub priority.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The priority is decoded
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_DecodePriority(uint8_t Copy_u8PriGroup, uint8_t Copy_u8Priority, uint8_t* Copy_pu8Preempt, uint8_t* Copy_pu8Sub);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to set the (preempt, sub) priority of a given source following the
+ * 				 configured PRIGROUP.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t Copy_u8Preempt: the preempt (group) priority, 0 is the highest.
+ * 				 uint8_t Copy_u8Sub: the sub priority.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 SCB_SetPriorityGroup is used first, changing the grouping later changes the pairs meaning
+
+ * 	@post 		 Interrupt priority is set for this src
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetGroupedPriority(NVIC_IRQs_t Copy_u8IRQNum, uint8_t Copy_u8Preempt, uint8_t Copy_u8Sub);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get the priority of a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t* Copy_pu8Priority: used to store the priority 0 ~ 15, NVIC_DecodePriority splits it.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The priority is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetPriority(NVIC_IRQs_t Copy_u8IRQNum, uint8_t* Copy_pu8Priority);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to apply the system priority table: all the entries are validated
+ * 				 against the configured PRIGROUP first, then written in one pass.
+ * 	@param 		 const NVIC_PriorityEntry_t* Copy_pTable: the table, one entry per IRQ.
+ * 				 uint8_t Copy_u8Count: the number of entries.
+ * 	@return 	 NVIC_ErrorState_t: return errorState, a bad entry leaves all the priorities untouched
+ * 	@pre		 SCB_SetPriorityGroup is used first
+
+ * 	@post 		 The priorities of the table IRQs are set
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_ApplyPriorityTable(const NVIC_PriorityEntry_t* Copy_pTable, uint8_t Copy_u8Count);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to check whether a source can preempt the handler of another one:
+ * 				 only a strictly higher preempt priority (lower value) preempts, the sub priority never does.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: the source being raised.
+ * 				 NVIC_IRQs_t Copy_u8ActiveIRQNum: the source whose handler is running.
+ * 				 uint8_t* Copy_pu8CanPreempt: used to store 1 if it preempts, 0 if it waits.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The result is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_CanPreempt(NVIC_IRQs_t Copy_u8IRQNum, NVIC_IRQs_t Copy_u8ActiveIRQNum, uint8_t* Copy_pu8CanPreempt);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get all the enabled sources able to preempt the handler of a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: the source whose handler is running.
+ * 				 uint32_t* Copy_pu32Preemptors: NVIC_IRQ_MASK_WORDS words used to store the mask, bit n for IRQ n.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The mask is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetPreemptors(NVIC_IRQs_t Copy_u8IRQNum, uint32_t* Copy_pu32Preemptors);
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to enable a group of sources, one ISER store per word of the mask.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The sources of the mask are enabled, the others are unchanged
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_EnableIRQs(const uint32_t* Copy_pu32Mask);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to disable a group of sources, one ICER store per word of the mask.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The sources of the mask are disabled once it returns (DSB & ISB), the others are unchanged
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_DisableIRQs(const uint32_t* Copy_pu32Mask);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to set the pending flags of a group of sources, one ISPR store per word.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The pending flags of the mask are set
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetPendingFlags(const uint32_t* Copy_pu32Mask);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to clear the pending flags of a group of sources, one ICPR store per word.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The pending flags of the mask are cleared
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_ClearPendingFlags(const uint32_t* Copy_pu32Mask);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to take a snapshot of the enabled sources, e.g. before a mode switch.
+ * 	@param 		 uint32_t* Copy_pu32Snapshot: NVIC_IRQ_MASK_WORDS words used to store the ISER words.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The enabled set is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SaveEnabledIRQs(uint32_t* Copy_pu32Snapshot);
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to restore an enabled set: per word, the sources out of the snapshot are
+ * 				 disabled (ICER) then the ones in it are enabled (ISER), 2 stores per word.
+ * 	@param 		 const uint32_t* Copy_pu32Snapshot: NVIC_IRQ_MASK_WORDS words from NVIC_SaveEnabledIRQs or built
+ * 				 with NVIC_IRQ_MASK_ADD.
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 Exactly the sources of the snapshot are enabled
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_RestoreEnabledIRQs(const uint32_t* Copy_pu32Snapshot);
+
+
+
 #endif
@@ -9,10 +9,25 @@
 #define NVIC_PRV_H
 
 /*This is for STM32F446RE And can be altered*/
-#define MASKABLE_EXCEPTIONS_START	3u
+#define MASKABLE_EXCEPTIONS_START	0u
 #define MASKABLE_EXCEPTIONS_END		96u
 #define NVIC_REGISTERS_SIZE			32u
 
+/*Priority: 4 implemented bits, the upper nibble of each IPR byte*/
+#define NVIC_PRIORITY_BITS			4u
+#define NVIC_PRIORITY_SHIFT			(8u - NVIC_PRIORITY_BITS)
+#define NVIC_PRIORITY_MAX			((1u << NVIC_PRIORITY_BITS) - 1u)
+#define NVIC_PRIGROUP_MAX			7u
+
+/*Vector table: the 16 system exceptions (initial SP first) then the IRQs, aligned to the power of 2 above its size*/
+#define NVIC_SYSTEM_VECTORS_NUM		16u
+#define NVIC_VECTORS_NUM			(NVIC_SYSTEM_VECTORS_NUM + MASKABLE_EXCEPTIONS_END + 1u)
+#define NVIC_VECTOR_TABLE_ALIGN		512u
+
+#if ((NVIC_VECTORS_NUM * 4u) > NVIC_VECTOR_TABLE_ALIGN)
+#error "NVIC_VECTOR_TABLE_ALIGN must be a power of 2 >= the vector table size"
+#endif
+
 #define NULL ((void *)0)
 
 
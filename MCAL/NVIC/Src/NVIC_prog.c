@@ -8,10 +8,130 @@
 #include <stdint.h>
 
 #include "Stm32F446xx.h"
+#include "CortexM4_Core.h"
+#include "MCAL_Config.h"
+
+#include "SCB_Interface.h"
 
 #include "NVIC_Prv.h"
 #include "NVIC_Interface.h"
 
+#ifdef MCAL_HOST_SIM
+#include "HOSTSIM_Interface.h"
+#endif
+
+
+/*
+ *
+ * @brief: The SRAM vector table pointed by VTOR after NVIC_RelocateVectorTable
+ *
+ * */
+static NVIC_Handler_t NVIC_VectorTable[NVIC_VECTORS_NUM] __attribute__((aligned(NVIC_VECTOR_TABLE_ALIGN)));
+
+
+
+/*
+ *
+ * @brief: The preempt bits of a PRIGROUP: (7 - PRIGROUP) bits of the priority byte, at most the implemented ones
+ *
+ * */
+static uint8_t NVIC_u8PreemptBits(uint8_t Copy_u8PriGroup)
+{
+	uint8_t Local_u8Bits = NVIC_PRIGROUP_MAX - Copy_u8PriGroup;
+
+	return (Local_u8Bits > NVIC_PRIORITY_BITS) ? NVIC_PRIORITY_BITS : Local_u8Bits;
+}
+
+
+
+/*
+ *
+ * @brief: The preempt priority of an IRQ, its priority without the sub bits
+ *
+ * */
+static uint8_t NVIC_u8GetPreempt(uint8_t Copy_u8IRQNum, uint8_t Copy_u8SubBits)
+{
+	return ((NVIC -> IPR[Copy_u8IRQNum]) >> NVIC_PRIORITY_SHIFT) >> Copy_u8SubBits;
+}
+
+
+
+/*
+ *
+ * @brief: The implemented IRQs bits of a mask word, up to MASKABLE_EXCEPTIONS_END
+ *
+ * */
+static uint32_t NVIC_u32WordIRQs(uint8_t Copy_u8RegNum)
+{
+	uint32_t Local_u32IRQs = 0;
+
+	if((Copy_u8RegNum * NVIC_REGISTERS_SIZE) <= MASKABLE_EXCEPTIONS_END)
+	{
+		Local_u32IRQs = (Copy_u8RegNum < (MASKABLE_EXCEPTIONS_END / NVIC_REGISTERS_SIZE)) ?
+						0xFFFFFFFFUL : ((2UL << (MASKABLE_EXCEPTIONS_END % NVIC_REGISTERS_SIZE)) - 1UL);
+	}
+
+	return Local_u32IRQs;
+}
+
+
+
+/*
+ *
+ * @brief: Checks a mask has no bits beyond the last IRQ
+ *
+ * */
+static NVIC_ErrorState_t NVIC_u8CheckMask(const uint32_t* Copy_pu32Mask)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+	uint8_t Local_u8RegNum;
+
+	if(Copy_pu32Mask == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else
+	{
+		for(Local_u8RegNum = 0; Local_u8RegNum < NVIC_IRQ_MASK_WORDS; Local_u8RegNum++)
+		{
+			if(!MCAL_PARAM_VALID((Copy_pu32Mask[Local_u8RegNum] & ~NVIC_u32WordIRQs(Local_u8RegNum)) == 0))
+			{
+				Local_u8ErrorStates = NVIC_Invalid_IRQ;
+			}
+		}
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/*
+ *
+ * @brief: Stores each non zero word of a checked mask to a set/clear registers array (write 1 to act, so no
+ * 		   read-modify-write)
+ *
+ * */
+static NVIC_ErrorState_t NVIC_u8WriteMask(volatile uint32_t* Copy_pu32Regs, const uint32_t* Copy_pu32Mask)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIC_u8CheckMask(Copy_pu32Mask);
+	uint8_t Local_u8RegNum;
+
+	if(Local_u8ErrorStates == NVIVC_Exit_Ok)
+	{
+		for(Local_u8RegNum = 0; Local_u8RegNum < NVIC_IRQ_MASK_WORDS; Local_u8RegNum++)
+		{
+			if(Copy_pu32Mask[Local_u8RegNum] != 0)
+			{
+				Copy_pu32Regs[Local_u8RegNum] = Copy_pu32Mask[Local_u8RegNum];
+			}
+		}
+	}
+
+	return Local_u8ErrorStates;
+}
+
 
 /****************************************************************************************************
  * 	@brief		 This Function is used to enable the interrupt of a given source.
@@ -28,7 +148,7 @@ NVIC_ErrorState_t NVIC_EnableIRQ(NVIC_IRQs_t Copy_u8IRQNum)
 
 	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
 
-	if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+	if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 	{
 		uint8_t Local_u8RegNum = Copy_u8IRQNum / NVIC_REGISTERS_SIZE;
 		uint8_t Local_u8BitNum = Copy_u8IRQNum % NVIC_REGISTERS_SIZE;
@@ -62,7 +182,7 @@ NVIC_ErrorState_t NVIC_DisableIRQ(NVIC_IRQs_t Copy_u8IRQNum)
 
 	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
 
-	if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+	if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 	{
 		uint8_t Local_u8RegNum = Copy_u8IRQNum / NVIC_REGISTERS_SIZE;
 		uint8_t Local_u8BitNum = Copy_u8IRQNum % NVIC_REGISTERS_SIZE;
@@ -87,6 +207,7 @@ NVIC_ErrorState_t NVIC_DisableIRQ(NVIC_IRQs_t Copy_u8IRQNum)
 /****************************************************************************************************
  * 	@brief		 This Function is used to set the priority of the interrupt of a given source.
  * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t Copy_u8Priority: the priority 0 ~ 15, clamped to 15 (lowest) when the checks are off.
  * 	@return 	 NVIC_ErrorState_t: return errorState
  * 	@pre		 perfable SCB_SetPriGroup is used to set the config type of this priority(group vs sub)
 
@@ -99,12 +220,15 @@ NVIC_ErrorState_t NVIC_SetPriority(NVIC_IRQs_t Copy_u8IRQNum, uint8_t Copy_u8Pri
 
 	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
 
-	if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+	if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 	{
 
-		if((Copy_u8Priority >= 0) && (Copy_u8Priority <= 15))
+		if(MCAL_PARAM_VALID(Copy_u8Priority <= NVIC_PRIORITY_MAX))
 		{
-			(NVIC -> IPR[Copy_u8IRQNum]) = Copy_u8Priority << 4;
+			/*Clamped so an unchecked out of range value can't spill out of the nibble & wrap to the highest priority*/
+			uint8_t Local_u8Priority = (Copy_u8Priority > NVIC_PRIORITY_MAX) ? NVIC_PRIORITY_MAX : Copy_u8Priority;
+
+			(NVIC -> IPR[Copy_u8IRQNum]) = (uint8_t)(Local_u8Priority << NVIC_PRIORITY_SHIFT);
 
 		}
 
@@ -145,7 +269,7 @@ NVIC_ErrorState_t NVIC_SetPendingFlag(NVIC_IRQs_t Copy_u8IRQNum)
 
 	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
 
-	if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+	if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 	{
 		uint8_t Local_u8RegNum = Copy_u8IRQNum / NVIC_REGISTERS_SIZE;
 		uint8_t Local_u8BitNum = Copy_u8IRQNum % NVIC_REGISTERS_SIZE;
@@ -180,7 +304,7 @@ NVIC_ErrorState_t NVIC_ClearPendingFlag(NVIC_IRQs_t Copy_u8IRQNum)
 
 	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
 
-	if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+	if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 	{
 		uint8_t Local_u8RegNum = Copy_u8IRQNum / NVIC_REGISTERS_SIZE;
 		uint8_t Local_u8BitNum = Copy_u8IRQNum % NVIC_REGISTERS_SIZE;
@@ -221,7 +345,7 @@ NVIC_ErrorState_t NVIC_GetActiveFlag(NVIC_IRQs_t Copy_u8IRQNum, NVIC_ActvFlag_t*
 	if(Copy_u8ActvFlgStat != NULL)
 	{
 
-		if((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END))
+		if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
 		{
 			uint8_t Local_u8RegNum = Copy_u8IRQNum / NVIC_REGISTERS_SIZE;
 			uint8_t Local_u8BitNum = Copy_u8IRQNum % NVIC_REGISTERS_SIZE;
@@ -248,3 +372,603 @@ NVIC_ErrorState_t NVIC_GetActiveFlag(NVIC_IRQs_t Copy_u8IRQNum, NVIC_ActvFlag_t*
 
 
 }
+
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to copy the active vector table (flash at reset) to an SRAM table and
+ * 				 point SCB VTOR at it, so the handlers can be installed at runtime by NVIC_SetVector.
+ * 	@param 		 None
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 Called once at startup, before any NVIC_SetVector
+
+ * 	@post 		 The exceptions are fetched from the SRAM table
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_RelocateVectorTable(void)
+{
+	uint8_t Local_u8Vector;
+
+#ifndef MCAL_HOST_SIM
+	const NVIC_Handler_t * Local_pActiveTable = (const NVIC_Handler_t *)(uintptr_t)(SCB -> VTOR);
+
+	/*The active table keeps serving the exceptions until VTOR is switched*/
+	for(Local_u8Vector = 0; Local_u8Vector < NVIC_VECTORS_NUM; Local_u8Vector++)
+	{
+		NVIC_VectorTable[Local_u8Vector] = Local_pActiveTable[Local_u8Vector];
+	}
+#else
+	/*HOST_SIM: no flash table to copy, the handlers are attached to the sim by NVIC_SetVector*/
+	for(Local_u8Vector = 0; Local_u8Vector < NVIC_VECTORS_NUM; Local_u8Vector++)
+	{
+		NVIC_VectorTable[Local_u8Vector] = NULL;
+	}
+#endif
+
+	/*The table is written before the core can fetch from it*/
+	CORE_DSB();
+	SCB -> VTOR = (uint32_t)(uintptr_t)NVIC_VectorTable;
+	CORE_DSB();
+	CORE_ISB();
+
+	return NVIVC_Exit_Ok;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to install the handler of a given source directly in the vector table,
+ * 				 the core then jumps to it with no driver wrapper in between.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 NVIC_Handler_t Copy_pHandler: the handler, it clears its peripheral flag (e.g. EXTI PR) itself.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 NVIC_RelocateVectorTable is called
+
+ * 	@post 		 The next exception of this src runs the handler
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetVector(NVIC_IRQs_t Copy_u8IRQNum, NVIC_Handler_t Copy_pHandler)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pHandler == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(!MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
+	{
+		Local_u8ErrorStates = NVIC_Invalid_IRQ;
+	}
+
+	else if((SCB -> VTOR) != (uint32_t)(uintptr_t)NVIC_VectorTable)
+	{
+		Local_u8ErrorStates = NVIC_VectorTable_NotRelocated;
+	}
+
+	else
+	{
+		/*A single word store, an exception taken meanwhile fetches either the old or the new handler*/
+		NVIC_VectorTable[NVIC_SYSTEM_VECTORS_NUM + Copy_u8IRQNum] = Copy_pHandler;
+		CORE_DSB();
+
+#ifdef MCAL_HOST_SIM
+		HOSTSIM_SetIRQHandler(Copy_u8IRQNum, Copy_pHandler);
+#endif
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get the handler installed for a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 NVIC_Handler_t* Copy_pHandler: used to store the handler.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 NVIC_RelocateVectorTable is called
+
+ * 	@post 		 The handler is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetVector(NVIC_IRQs_t Copy_u8IRQNum, NVIC_Handler_t* Copy_pHandler)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pHandler == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(!MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
+	{
+		Local_u8ErrorStates = NVIC_Invalid_IRQ;
+	}
+
+	else if((SCB -> VTOR) != (uint32_t)(uintptr_t)NVIC_VectorTable)
+	{
+		Local_u8ErrorStates = NVIC_VectorTable_NotRelocated;
+	}
+
+	else
+	{
+		*Copy_pHandler = NVIC_VectorTable[NVIC_SYSTEM_VECTORS_NUM + Copy_u8IRQNum];
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to encode a (preempt, sub) priority pair for a PRIGROUP into the value
+ * 				 taken by NVIC_SetPriority: with 4 implemented bits, (7 - PRIGROUP) of them are preempt bits
+ * 				 (at most 4), the remaining ones are sub bits.
+ * 	@param 		 uint8_t Copy_u8PriGroup: the AIRCR PRIGROUP 0 ~ 7 (SCB_GetPriorityGroup).
+ * 				 uint8_t Copy_u8Preempt: the preempt (group) priority, 0 is the highest.
+ * 				 uint8_t Copy_u8Sub: the sub priority, orders the pending IRQs of the same preempt priority.
+ * 				 uint8_t* Copy_pu8Priority: used to store the encoded priority 0 ~ 15.
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_Priority if a level doesn't fit its bits
+ * 	@pre		 None
+
+ * 	@post 		 The priority is encoded
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_EncodePriority(uint8_t Copy_u8PriGroup, uint8_t Copy_u8Preempt, uint8_t Copy_u8Sub, uint8_t* Copy_pu8Priority)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pu8Priority == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(Copy_u8PriGroup > NVIC_PRIGROUP_MAX)
+	{
+		Local_u8ErrorStates = NVIC_Invalid_PriGroup;
+	}
+
+	else
+	{
+		uint8_t Local_u8PreemptBits = NVIC_u8PreemptBits(Copy_u8PriGroup);
+		uint8_t Local_u8SubBits = NVIC_PRIORITY_BITS - Local_u8PreemptBits;
+
+		if((Copy_u8Preempt >= (1u << Local_u8PreemptBits)) || (Copy_u8Sub >= (1u << Local_u8SubBits)))
+		{
+			Local_u8ErrorStates = NVIC_Invalid_Priority;
+		}
+
+		else
+		{
+			*Copy_pu8Priority = (uint8_t)((Copy_u8Preempt << Local_u8SubBits) | Copy_u8Sub);
+		}
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to decode a priority 0 ~ 15 into its (preempt, sub) pair for a PRIGROUP.
+ * 	@param 		 uint8_t Copy_u8PriGroup: the AIRCR PRIGROUP 0 ~ 7 (SCB_GetPriorityGroup).
+ * 				 uint8_t Copy_u8Priority: the priority as set by NVIC_SetPriority.
+ * 				 uint8_t* Copy_pu8Preempt: used to store the preempt priority.
+ * 				 uint8_t* Copy_pu8Sub: used to store the sub priority.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The priority is decoded
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_DecodePriority(uint8_t Copy_u8PriGroup, uint8_t Copy_u8Priority, uint8_t* Copy_pu8Preempt, uint8_t* Copy_pu8Sub)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if((Copy_pu8Preempt == NULL) || (Copy_pu8Sub == NULL))
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(Copy_u8PriGroup > NVIC_PRIGROUP_MAX)
+	{
+		Local_u8ErrorStates = NVIC_Invalid_PriGroup;
+	}
+
+	else if(Copy_u8Priority > NVIC_PRIORITY_MAX)
+	{
+		Local_u8ErrorStates = NVIC_Invalid_Priority;
+	}
+
+	else
+	{
+		uint8_t Local_u8SubBits = NVIC_PRIORITY_BITS - NVIC_u8PreemptBits(Copy_u8PriGroup);
+
+		*Copy_pu8Preempt = Copy_u8Priority >> Local_u8SubBits;
+		*Copy_pu8Sub = Copy_u8Priority & ((1u << Local_u8SubBits) - 1u);
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to set the (preempt, sub) priority of a given source following the
+ * 				 configured PRIGROUP.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t Copy_u8Preempt: the preempt (group) priority, 0 is the highest.
+ * 				 uint8_t Copy_u8Sub: the sub priority.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 SCB_SetPriorityGroup is used first, changing the grouping later changes the pairs meaning
+
+ * 	@post 		 Interrupt priority is set for this src
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetGroupedPriority(NVIC_IRQs_t Copy_u8IRQNum, uint8_t Copy_u8Preempt, uint8_t Copy_u8Sub)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates;
+	uint8_t Local_u8PriGroup;
+	uint8_t Local_u8Priority;
+
+	SCB_GetPriorityGroup(&Local_u8PriGroup);
+
+	Local_u8ErrorStates = NVIC_EncodePriority(Local_u8PriGroup, Copy_u8Preempt, Copy_u8Sub, &Local_u8Priority);
+
+	if(Local_u8ErrorStates == NVIVC_Exit_Ok)
+	{
+		Local_u8ErrorStates = NVIC_SetPriority(Copy_u8IRQNum, Local_u8Priority);
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get the priority of a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: an enum value that holds the IRQ number(position) from the vector table.
+ * 				 uint8_t* Copy_pu8Priority: used to store the priority 0 ~ 15, NVIC_DecodePriority splits it.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The priority is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetPriority(NVIC_IRQs_t Copy_u8IRQNum, uint8_t* Copy_pu8Priority)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pu8Priority == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
+	{
+		*Copy_pu8Priority = (NVIC -> IPR[Copy_u8IRQNum]) >> NVIC_PRIORITY_SHIFT;
+	}
+
+	else
+	{
+		Local_u8ErrorStates = NVIC_Invalid_IRQ;
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to apply the system priority table: all the entries are validated
+ * 				 against the configured PRIGROUP first, then written in one pass.
+ * 	@param 		 const NVIC_PriorityEntry_t* Copy_pTable: the table, one entry per IRQ.
+ * 				 uint8_t Copy_u8Count: the number of entries.
+ * 	@return 	 NVIC_ErrorState_t: return errorState, a bad entry leaves all the priorities untouched
+ * 	@pre		 SCB_SetPriorityGroup is used first
+
+ * 	@post 		 The priorities of the table IRQs are set
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Non
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_ApplyPriorityTable(const NVIC_PriorityEntry_t* Copy_pTable, uint8_t Copy_u8Count)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+	uint8_t Local_u8PriGroup;
+	uint8_t Local_u8Priority;
+	uint8_t Local_u8Counter;
+
+	if(Copy_pTable == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else
+	{
+		SCB_GetPriorityGroup(&Local_u8PriGroup);
+
+		/*Validating all the entries first so a bad one leaves the priorities untouched*/
+		for(Local_u8Counter = 0; Local_u8Counter < Copy_u8Count; Local_u8Counter++)
+		{
+			if(!MCAL_PARAM_VALID((Copy_pTable[Local_u8Counter].IRQ >= MASKABLE_EXCEPTIONS_START) && (Copy_pTable[Local_u8Counter].IRQ <= MASKABLE_EXCEPTIONS_END)))
+			{
+				Local_u8ErrorStates = NVIC_Invalid_IRQ;
+			}
+
+			else
+			{
+				Local_u8ErrorStates = NVIC_EncodePriority(Local_u8PriGroup, Copy_pTable[Local_u8Counter].Preempt, Copy_pTable[Local_u8Counter].Sub, &Local_u8Priority);
+			}
+
+			if(Local_u8ErrorStates != NVIVC_Exit_Ok)
+			{
+				break;
+			}
+		}
+
+		if(Local_u8ErrorStates == NVIVC_Exit_Ok)
+		{
+			for(Local_u8Counter = 0; Local_u8Counter < Copy_u8Count; Local_u8Counter++)
+			{
+				NVIC_EncodePriority(Local_u8PriGroup, Copy_pTable[Local_u8Counter].Preempt, Copy_pTable[Local_u8Counter].Sub, &Local_u8Priority);
+
+				(NVIC -> IPR[Copy_pTable[Local_u8Counter].IRQ]) = Local_u8Priority << NVIC_PRIORITY_SHIFT;
+			}
+		}
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to check whether a source can preempt the handler of another one:
+ * 				 only a strictly higher preempt priority (lower value) preempts, the sub priority never does.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: the source being raised.
+ * 				 NVIC_IRQs_t Copy_u8ActiveIRQNum: the source whose handler is running.
+ * 				 uint8_t* Copy_pu8CanPreempt: used to store 1 if it preempts, 0 if it waits.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The result is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_CanPreempt(NVIC_IRQs_t Copy_u8IRQNum, NVIC_IRQs_t Copy_u8ActiveIRQNum, uint8_t* Copy_pu8CanPreempt)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pu8CanPreempt == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(!MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END) &&
+								(Copy_u8ActiveIRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8ActiveIRQNum <= MASKABLE_EXCEPTIONS_END)))
+	{
+		Local_u8ErrorStates = NVIC_Invalid_IRQ;
+	}
+
+	else
+	{
+		uint8_t Local_u8PriGroup;
+		uint8_t Local_u8SubBits;
+
+		SCB_GetPriorityGroup(&Local_u8PriGroup);
+		Local_u8SubBits = NVIC_PRIORITY_BITS - NVIC_u8PreemptBits(Local_u8PriGroup);
+
+		*Copy_pu8CanPreempt = (NVIC_u8GetPreempt(Copy_u8IRQNum, Local_u8SubBits) < NVIC_u8GetPreempt(Copy_u8ActiveIRQNum, Local_u8SubBits));
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to get all the enabled sources able to preempt the handler of a given source.
+ * 	@param 		 NVIC_IRQs_t Copy_u8IRQNum: the source whose handler is running.
+ * 				 uint32_t* Copy_pu32Preemptors: NVIC_IRQ_MASK_WORDS words used to store the mask, bit n for IRQ n.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The mask is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_GetPreemptors(NVIC_IRQs_t Copy_u8IRQNum, uint32_t* Copy_pu32Preemptors)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+
+	if(Copy_pu32Preemptors == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else if(MCAL_PARAM_VALID((Copy_u8IRQNum >= MASKABLE_EXCEPTIONS_START) && (Copy_u8IRQNum <= MASKABLE_EXCEPTIONS_END)))
+	{
+		uint8_t Local_u8PriGroup;
+		uint8_t Local_u8SubBits;
+		uint8_t Local_u8ActivePreempt;
+		uint8_t Local_u8IRQ;
+		uint8_t Local_u8RegNum;
+
+		SCB_GetPriorityGroup(&Local_u8PriGroup);
+		Local_u8SubBits = NVIC_PRIORITY_BITS - NVIC_u8PreemptBits(Local_u8PriGroup);
+		Local_u8ActivePreempt = NVIC_u8GetPreempt(Copy_u8IRQNum, Local_u8SubBits);
+
+		for(Local_u8RegNum = 0; Local_u8RegNum < NVIC_IRQ_MASK_WORDS; Local_u8RegNum++)
+		{
+			Copy_pu32Preemptors[Local_u8RegNum] = 0;
+		}
+
+		for(Local_u8IRQ = MASKABLE_EXCEPTIONS_START; Local_u8IRQ <= MASKABLE_EXCEPTIONS_END; Local_u8IRQ++)
+		{
+			Local_u8RegNum = Local_u8IRQ / NVIC_REGISTERS_SIZE;
+
+			if((1 & ((NVIC -> ISER[Local_u8RegNum]) >> (Local_u8IRQ % NVIC_REGISTERS_SIZE))) &&
+				(NVIC_u8GetPreempt(Local_u8IRQ, Local_u8SubBits) < Local_u8ActivePreempt))
+			{
+				Copy_pu32Preemptors[Local_u8RegNum] |= (1UL << (Local_u8IRQ % NVIC_REGISTERS_SIZE));
+			}
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorStates = NVIC_Invalid_IRQ;
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to enable a group of sources, one ISER store per word of the mask.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The sources of the mask are enabled, the others are unchanged
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_EnableIRQs(const uint32_t* Copy_pu32Mask)
+{
+	return NVIC_u8WriteMask(NVIC -> ISER, Copy_pu32Mask);
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to disable a group of sources, one ICER store per word of the mask.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The sources of the mask are disabled once it returns (DSB & ISB), the others are unchanged
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_DisableIRQs(const uint32_t* Copy_pu32Mask)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIC_u8WriteMask(NVIC -> ICER, Copy_pu32Mask);
+
+	/*An IRQ already pending can still be taken right after the stores, until they complete*/
+	CORE_DSB();
+	CORE_ISB();
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to set the pending flags of a group of sources, one ISPR store per word.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The pending flags of the mask are set
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SetPendingFlags(const uint32_t* Copy_pu32Mask)
+{
+	return NVIC_u8WriteMask(NVIC -> ISPR, Copy_pu32Mask);
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to clear the pending flags of a group of sources, one ICPR store per word.
+ * 	@param 		 const uint32_t* Copy_pu32Mask: NVIC_IRQ_MASK_WORDS words, bit n for IRQ n (NVIC_IRQ_MASK_ADD).
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 The pending flags of the mask are cleared
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_ClearPendingFlags(const uint32_t* Copy_pu32Mask)
+{
+	return NVIC_u8WriteMask(NVIC -> ICPR, Copy_pu32Mask);
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to take a snapshot of the enabled sources, e.g. before a mode switch.
+ * 	@param 		 uint32_t* Copy_pu32Snapshot: NVIC_IRQ_MASK_WORDS words used to store the ISER words.
+ * 	@return 	 NVIC_ErrorState_t: return errorState
+ * 	@pre		 None
+
+ * 	@post 		 The enabled set is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_SaveEnabledIRQs(uint32_t* Copy_pu32Snapshot)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIVC_Exit_Ok;
+	uint8_t Local_u8RegNum;
+
+	if(Copy_pu32Snapshot == NULL)
+	{
+		Local_u8ErrorStates = NVIC_NULL_PTR;
+	}
+
+	else
+	{
+		for(Local_u8RegNum = 0; Local_u8RegNum < NVIC_IRQ_MASK_WORDS; Local_u8RegNum++)
+		{
+			Copy_pu32Snapshot[Local_u8RegNum] = (NVIC_u32WordIRQs(Local_u8RegNum) != 0) ? (NVIC -> ISER[Local_u8RegNum]) : 0;
+		}
+	}
+
+	return Local_u8ErrorStates;
+}
+
+
+
+/****************************************************************************************************
+ * 	@brief		 This Function is used to restore an enabled set: per word, the sources out of the snapshot are
+ * 				 disabled (ICER) then the ones in it are enabled (ISER), 2 stores per word.
+ * 	@param 		 const uint32_t* Copy_pu32Snapshot: NVIC_IRQ_MASK_WORDS words from NVIC_SaveEnabledIRQs or built
+ * 				 with NVIC_IRQ_MASK_ADD.
+ * 	@return 	 NVIC_ErrorState_t: NVIC_Invalid_IRQ if a bit is beyond the last IRQ, nothing is written then
+ * 	@pre		 None
+
+ * 	@post 		 Exactly the sources of the snapshot are enabled
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+NVIC_ErrorState_t NVIC_RestoreEnabledIRQs(const uint32_t* Copy_pu32Snapshot)
+{
+	NVIC_ErrorState_t Local_u8ErrorStates = NVIC_u8CheckMask(Copy_pu32Snapshot);
+	uint32_t Local_u32Disabled[NVIC_IRQ_MASK_WORDS];
+	uint8_t Local_u8RegNum;
+
+	if(Local_u8ErrorStates == NVIVC_Exit_Ok)
+	{
+		for(Local_u8RegNum = 0; Local_u8RegNum < NVIC_IRQ_MASK_WORDS; Local_u8RegNum++)
+		{
+			Local_u32Disabled[Local_u8RegNum] = ~Copy_pu32Snapshot[Local_u8RegNum] & NVIC_u32WordIRQs(Local_u8RegNum);
+		}
+
+		/*The disables first: the sources of the old set only are off before the new ones are on*/
+		NVIC_DisableIRQs(Local_u32Disabled);
+		NVIC_EnableIRQs(Copy_pu32Snapshot);
+	}
+
+	return Local_u8ErrorStates;
+}
@@ -36,7 +36,8 @@
 typedef enum
 {
 	SCB_Exit_Ok,
-	SCB_Invalid_PriGroup
+	SCB_Invalid_PriGroup,
+	SCB_NULL_Ptr
 
 
 
@@ -58,9 +59,9 @@ typedef enum
  * 	Decription: This Function is used to set the NVIC priority config type
  * 	Parameters: - uint32_t Copy_u32PriGroup: expecting a hex macro indicating the Priority group config
  * 	Returns: SCB_ErrorStates_t
- * 	Preconditions: - VECTKEY must be written at the same time with the PRIGROUP
+ * 	Preconditions: - None, the VECTKEY is always written with the PRIGROUP
  * 				   -
- * 	Side effects: No side effects
+ * 	Side effects: The other AIRCR bits are kept, the reset & clear active requests are never written
  * 	Post Conditions: PRIGROUP is indicated succesfully
  * 	Synch/Asynch: Synch.
  * 	Reentrant/NonReenterant: Non
@@ -69,5 +70,20 @@ SCB_ErrorStates_t SCB_SetPriorityGroup(uint32_t Copy_u32PriGroup);
 
 
 
+/***************************************************************************************************
+ * 	Decription: This Function is used to get the configured NVIC priority grouping
+ * 	Parameters: - uint8_t* Copy_pu8PriGroup: ptr to receive the AIRCR PRIGROUP field 0 ~ 7 (3 for SCB_PRI_GROUP_3...)
+ * 	Returns: SCB_ErrorStates_t
+ * 	Preconditions: - None
+ * 				   -
+ * 	Side effects: No side effects
+ * 	Post Conditions: PRIGROUP is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+SCB_ErrorStates_t SCB_GetPriorityGroup(uint8_t* Copy_pu8PriGroup);
+
+
+
 
 #endif
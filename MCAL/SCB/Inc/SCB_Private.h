@@ -12,7 +12,11 @@
 /********************************    Private Definition   ***************************/
 #define SCB_VECTKEY				0x05FA			/*Must be written whenever to write in this register*/
 
+#define NULL ((void *)0)
+
 /*Pritory group configs, ready to be written*/
+#define SCB_PRI_GROUP_MIN		3u				/*Below 3 all the 4 implemented bits are group priority as in 3*/
+#define SCB_PRI_GROUP_MAX		7u
 
 
 
@@ -19,9 +19,9 @@
  * 	Decription: This Function is used to set the NVIC priority config type
  * 	Parameters: - uint32_t Copy_u32PriGroup: expecting a hex macro indicating the Priority group config
  * 	Returns: SCB_ErrorStates_t
- * 	Preconditions: - VECTKEY must be written at the same time with the PRIGROUP
+ * 	Preconditions: - None, the VECTKEY is always written with the PRIGROUP
  * 				   -
- * 	Side effects: No side effects
+ * 	Side effects: The other AIRCR bits are kept, the reset & clear active requests are never written
  * 	Post Conditions: PRIGROUP is indicated succesfully
  * 	Synch/Asynch: Synch.
  * 	Reentrant/NonReenterant: Non
@@ -30,9 +30,21 @@ SCB_ErrorStates_t SCB_SetPriorityGroup(uint32_t Copy_u32PriGroup)
 {
 	SCB_ErrorStates_t Local_u8ErrorState = SCB_Exit_Ok;
 
-	if((Copy_u32PriGroup >= SCB_PRI_GROUP_3) && (Copy_u32PriGroup <= SCB_PRI_GROUP_7))
+	uint8_t Local_u8PriGroup = (Copy_u32PriGroup >> AIRCR_PRIGROUP) & SCB_MASK_3BITS;
+
+	/*Only the PRIGROUP field & the key are accepted, the key is written anyway*/
+	if(((Copy_u32PriGroup & ~((SCB_MASK_16BITS << AIRCR_VECTKEY) | (SCB_MASK_3BITS << AIRCR_PRIGROUP))) == 0u) &&
+		(Local_u8PriGroup >= SCB_PRI_GROUP_MIN) && (Local_u8PriGroup <= SCB_PRI_GROUP_MAX))
 	{
-		SCB -> AIRCR = Copy_u32PriGroup;
+		uint32_t Local_u32AIRCR = SCB -> AIRCR;
+
+		/*Reads give VECTKEYSTAT in the key field, the reset & clear active bits must not be set back*/
+		Local_u32AIRCR &= ~((SCB_MASK_16BITS << AIRCR_VECTKEY) | (SCB_MASK_3BITS << AIRCR_PRIGROUP) |
+							(SCB_MASK_1BIT << AIRCR_SYSRESETREQ) | (SCB_MASK_1BIT << AIRCR_VECTCLRACTIVE) | (SCB_MASK_1BIT << AIRCR_VECTRESET));
+
+		Local_u32AIRCR |= ((uint32_t)SCB_VECTKEY << AIRCR_VECTKEY) | ((uint32_t)Local_u8PriGroup << AIRCR_PRIGROUP);
+
+		SCB -> AIRCR = Local_u32AIRCR;
 	}
 
 	else
@@ -49,3 +61,32 @@ SCB_ErrorStates_t SCB_SetPriorityGroup(uint32_t Copy_u32PriGroup)
 }
 
 
+
+
+/***************************************************************************************************
+ * 	Decription: This Function is used to get the configured NVIC priority grouping
+ * 	Parameters: - uint8_t* Copy_pu8PriGroup: ptr to receive the AIRCR PRIGROUP field 0 ~ 7 (3 for SCB_PRI_GROUP_3...)
+ * 	Returns: SCB_ErrorStates_t
+ * 	Preconditions: - None
+ * 				   -
+ * 	Side effects: No side effects
+ * 	Post Conditions: PRIGROUP is retrieved
+ * 	Synch/Asynch: Synch.
+ * 	Reentrant/NonReenterant: Re
+ ***************************************************************************************************/
+SCB_ErrorStates_t SCB_GetPriorityGroup(uint8_t* Copy_pu8PriGroup)
+{
+	SCB_ErrorStates_t Local_u8ErrorState = SCB_Exit_Ok;
+
+	if(Copy_pu8PriGroup != NULL)
+	{
+		*Copy_pu8PriGroup = ((SCB -> AIRCR) >> AIRCR_PRIGROUP) & SCB_MASK_3BITS;
+	}
+
+	else
+	{
+		Local_u8ErrorState = SCB_NULL_Ptr;
+	}
+
+	return Local_u8ErrorState;
+}
@@ -15,7 +15,8 @@ typedef enum
 {
 	SYSCFG_Exit_Ok,
 	SYSCFG_InvalidIntPort,
-	SYSCFG_InvalidIntLine
+	SYSCFG_InvalidIntLine,
+	SYSCFG_NULL_Ptr_Err
 
 }SYSCFG_ErroState_t;
 
@@ -54,7 +55,8 @@ typedef enum
 	SYSCFG_PORTD,
 	SYSCFG_PORTE,
 	SYSCFG_PORTF,
-	SYSCFG_PORTG
+	SYSCFG_PORTG,
+	SYSCFG_PORTH
 }SYSCFG_IntPort_t;
 
 
@@ -74,4 +76,21 @@ SYSCFG_ErroState_t SYSCFG_SetEXTIPort(SYSCFG_IntPort_t Copy_u8Port, SYSCFG_ExtIn
 
 
 
+/**************************************************************************************************************
+ * 	Decription:                 This Function is used to set the EXTI Ports of several lines, each EXTICR register
+ * 								is written once whatever the number of its lines
+ * 	Parameters:                 - uint16_t Copy_u16LinesMask: the lines to be set, bit n for SYSCFG_EXTIn
+ * 								- const SYSCFG_IntPort_t *Copy_pPorts: 16 entries array, the port of line n at index n,
+ * 								  the entries of the lines out of the mask are ignored
+ * 	Returns:                    - SYSCFG_ErroState_t: an enum indicating the error state of the function
+ * 	Preconditions:              -  RCC must be configured and a system clk type is selected.
+ * 	Side effects:               No side effects
+ * 	Post Conditions:            EXTI ports of the lines are selected
+ * 	Synch/Asynch:               Synch.
+ * 	Reentrant/NonReenterant:    Non
+ *************************************************************************************************************/
+SYSCFG_ErroState_t SYSCFG_SetEXTIPorts(uint16_t Copy_u16LinesMask, const SYSCFG_IntPort_t *Copy_pPorts);
+
+
+
 #endif
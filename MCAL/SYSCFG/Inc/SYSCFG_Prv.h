@@ -11,7 +11,12 @@
 
 
 
+#define NULL ((void *)0)
+
 #define LINES_NUM_PER_REG	4u
+#define EXTICR_REGS_NUM		4u
+#define EXTI_LINES_NUM		16u
+#define EXTICR_FIELD_MASK	0b1111u
 
 
 #endif
@@ -9,6 +9,7 @@
 #include "stdint.h"
 
 #include "Stm32F446xx.h"
+#include "MCAL_Config.h"
 
 #include "SYSCFG_Prv.h"
 #include "SYSCFG_Interface.h"
@@ -18,9 +19,9 @@ SYSCFG_ErroState_t SYSCFG_SetEXTIPort(SYSCFG_IntPort_t Copy_u8Port, SYSCFG_ExtIn
 {
 	SYSCFG_ErroState_t Local_u8ErrorState = SYSCFG_Exit_Ok;
 
-	if((Copy_u8Port >= SYSCFG_PORTA) && (Copy_u8Port <= SYSCFG_PORTG))
+	if(MCAL_PARAM_VALID((Copy_u8Port >= SYSCFG_PORTA) && (Copy_u8Port <= SYSCFG_PORTH)))
 	{
-		if((Copy_u8line >= SYSCFG_EXTI0) && (Copy_u8line <= SYSCFG_EXTI15))
+		if(MCAL_PARAM_VALID((Copy_u8line >= SYSCFG_EXTI0) && (Copy_u8line <= SYSCFG_EXTI15)))
 		{
 			uint8_t Local_u8RegNum = Copy_u8line / LINES_NUM_PER_REG;
 			uint8_t Local_u8BitNum = ((Copy_u8line % LINES_NUM_PER_REG) * LINES_NUM_PER_REG);
@@ -51,3 +52,53 @@ SYSCFG_ErroState_t SYSCFG_SetEXTIPort(SYSCFG_IntPort_t Copy_u8Port, SYSCFG_ExtIn
 
 }
 
+
+
+SYSCFG_ErroState_t SYSCFG_SetEXTIPorts(uint16_t Copy_u16LinesMask, const SYSCFG_IntPort_t *Copy_pPorts)
+{
+	SYSCFG_ErroState_t Local_u8ErrorState = SYSCFG_Exit_Ok;
+	uint32_t Local_u32Masks[EXTICR_REGS_NUM] = {0};
+	uint32_t Local_u32Values[EXTICR_REGS_NUM] = {0};
+	uint8_t Local_u8Line;
+	uint8_t Local_u8RegNum;
+
+	if(Copy_pPorts != NULL)
+	{
+		/*Building the registers images first so a bad port leaves the hardware untouched*/
+		for(Local_u8Line = 0; Local_u8Line < EXTI_LINES_NUM; Local_u8Line++)
+		{
+			if((Copy_u16LinesMask >> Local_u8Line) & 1u)
+			{
+				uint8_t Local_u8BitNum = ((Local_u8Line % LINES_NUM_PER_REG) * LINES_NUM_PER_REG);
+
+				if(!MCAL_PARAM_VALID((Copy_pPorts[Local_u8Line] >= SYSCFG_PORTA) && (Copy_pPorts[Local_u8Line] <= SYSCFG_PORTH)))
+				{
+					Local_u8ErrorState = SYSCFG_InvalidIntPort;
+					break;
+				}
+
+				Local_u8RegNum = Local_u8Line / LINES_NUM_PER_REG;
+				Local_u32Masks[Local_u8RegNum] |= (EXTICR_FIELD_MASK << Local_u8BitNum);
+				Local_u32Values[Local_u8RegNum] |= ((uint32_t)Copy_pPorts[Local_u8Line] << Local_u8BitNum);
+			}
+		}
+
+		if(Local_u8ErrorState == SYSCFG_Exit_Ok)
+		{
+			for(Local_u8RegNum = 0; Local_u8RegNum < EXTICR_REGS_NUM; Local_u8RegNum++)
+			{
+				if(Local_u32Masks[Local_u8RegNum] != 0u)
+				{
+					(SYSCFG -> EXTICR[Local_u8RegNum]) = ((SYSCFG -> EXTICR[Local_u8RegNum]) & ~Local_u32Masks[Local_u8RegNum]) | Local_u32Values[Local_u8RegNum];
+				}
+			}
+		}
+	}
+
+	else
+	{
+		Local_u8ErrorState = SYSCFG_NULL_Ptr_Err;
+	}
+
+	return Local_u8ErrorState;
+}
@@ -0,0 +1,169 @@
+/***************************************************************************************************
+ * @file: 			IRQPROF_Decode.c
+ * @brief: 			Host tool decoding the binary table of IRQPROF_Dump() (format in MCAL/IRQPROF/Inc/IRQPROF_Prv.h)
+ * 					Build: gcc -std=c99 -O2 IRQPROF_Decode.c -o irqprof_decode
+ * 					Usage: irqprof_decode <dump.bin>
+ * @author: 		Ibrahim Saber
+ * @version: 		1.0
+ * @date: 			17-10-2026
+ ****************************************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+
+#define DECODE_MAGIC			"IRQP"
+#define DECODE_VERSION			1u
+#define DECODE_HEADER_SIZE		12u
+#define DECODE_RECORD_SIZE		18u
+#define DECODE_MAX_SIZE			(DECODE_HEADER_SIZE + (255u * 2u * DECODE_RECORD_SIZE))
+
+
+typedef struct
+{
+	uint8_t Id;
+	uint8_t MaxDepth;
+	uint32_t Count;
+	uint64_t TotalCycles;
+	uint32_t MaxCycles;
+
+}DECODE_Record_t;
+
+
+
+/*
+ *
+ * @brief: Reading a little endian field, returns the next byte
+ *
+ * */
+static const uint8_t * DECODE_pu8Get(const uint8_t *Copy_pu8Src, uint64_t *Copy_pu64Value, uint8_t Copy_u8Bytes)
+{
+	uint8_t Local_u8Byte;
+
+	*Copy_pu64Value = 0;
+
+	for(Local_u8Byte = 0; Local_u8Byte < Copy_u8Bytes; Local_u8Byte++)
+	{
+		*Copy_pu64Value |= ((uint64_t)Copy_pu8Src[Local_u8Byte] << (Local_u8Byte * 8u));
+	}
+
+	return Copy_pu8Src + Copy_u8Bytes;
+}
+
+
+
+static const uint8_t * DECODE_pu8GetRecord(const uint8_t *Copy_pu8Src, DECODE_Record_t *Copy_pRecord)
+{
+	uint64_t Local_u64Value;
+
+	Copy_pu8Src = DECODE_pu8Get(Copy_pu8Src, &Local_u64Value, 1u);
+	Copy_pRecord -> Id = (uint8_t)Local_u64Value;
+	Copy_pu8Src = DECODE_pu8Get(Copy_pu8Src, &Local_u64Value, 1u);
+	Copy_pRecord -> MaxDepth = (uint8_t)Local_u64Value;
+	Copy_pu8Src = DECODE_pu8Get(Copy_pu8Src, &Local_u64Value, 4u);
+	Copy_pRecord -> Count = (uint32_t)Local_u64Value;
+	Copy_pu8Src = DECODE_pu8Get(Copy_pu8Src, &Local_u64Value, 8u);
+	Copy_pRecord -> TotalCycles = Local_u64Value;
+	Copy_pu8Src = DECODE_pu8Get(Copy_pu8Src, &Local_u64Value, 4u);
+	Copy_pRecord -> MaxCycles = (uint32_t)Local_u64Value;
+
+	return Copy_pu8Src;
+}
+
+
+
+/*
+ *
+ * @brief: Printing a records table, the share is of the cycles of all the IRQs
+ *
+ * */
+static const uint8_t * DECODE_pu8PrintRecords(const uint8_t *Copy_pu8Src, uint8_t Copy_u8Num, const char *Copy_pcName,
+											  uint32_t Copy_u32CoreClkHz, uint64_t Copy_u64AllCycles)
+{
+	DECODE_Record_t Local_Record;
+	uint8_t Local_u8Rec;
+
+	printf("%-10s %10s %14s %10s %10s %10s %6s %7s\n", Copy_pcName, "count", "total cyc", "avg cyc", "max cyc", "max us", "depth", "share");
+
+	for(Local_u8Rec = 0; Local_u8Rec < Copy_u8Num; Local_u8Rec++)
+	{
+		Copy_pu8Src = DECODE_pu8GetRecord(Copy_pu8Src, &Local_Record);
+
+		printf("%-10u %10lu %14llu %10llu %10lu %10.2f %6u %6.1f%%\n",
+			   (unsigned)Local_Record.Id, (unsigned long)Local_Record.Count, (unsigned long long)Local_Record.TotalCycles,
+			   (Local_Record.Count != 0u) ? (unsigned long long)(Local_Record.TotalCycles / Local_Record.Count) : 0ull, (unsigned long)Local_Record.MaxCycles,
+			   (Copy_u32CoreClkHz != 0u) ? ((double)Local_Record.MaxCycles * 1e6 / Copy_u32CoreClkHz) : 0.0,
+			   (unsigned)Local_Record.MaxDepth,
+			   (Copy_u64AllCycles != 0u) ? ((double)Local_Record.TotalCycles * 100.0 / (double)Copy_u64AllCycles) : 0.0);
+	}
+
+	return Copy_pu8Src;
+}
+
+
+
+int main(int argc, char *argv[])
+{
+	static uint8_t Local_au8Dump[DECODE_MAX_SIZE];
+	FILE *Local_pFile;
+	size_t Local_Size;
+	int Local_Ret = 1;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "usage: %s <dump.bin>\n", argv[0]);
+	}
+
+	else if((Local_pFile = fopen(argv[1], "rb")) == NULL)
+	{
+		perror(argv[1]);
+	}
+
+	else
+	{
+		Local_Size = fread(Local_au8Dump, 1u, sizeof(Local_au8Dump), Local_pFile);
+		fclose(Local_pFile);
+
+		if((Local_Size < DECODE_HEADER_SIZE) || (memcmp(Local_au8Dump, DECODE_MAGIC, 4u) != 0) || (Local_au8Dump[4] != DECODE_VERSION))
+		{
+			fprintf(stderr, "%s: not an IRQPROF dump (v%u)\n", argv[1], DECODE_VERSION);
+		}
+
+		else if(Local_Size < (DECODE_HEADER_SIZE + ((size_t)(Local_au8Dump[5] + Local_au8Dump[6]) * DECODE_RECORD_SIZE)))
+		{
+			fprintf(stderr, "%s: truncated dump\n", argv[1]);
+		}
+
+		else
+		{
+			uint8_t Local_u8IRQs = Local_au8Dump[5];
+			uint8_t Local_u8Lines = Local_au8Dump[6];
+			const uint8_t *Local_pu8Src = Local_au8Dump + 8u;
+			uint64_t Local_u64Value;
+			uint32_t Local_u32CoreClkHz;
+			uint64_t Local_u64AllCycles = 0;
+			DECODE_Record_t Local_Record;
+			uint8_t Local_u8Rec;
+
+			Local_pu8Src = DECODE_pu8Get(Local_pu8Src, &Local_u64Value, 4u);
+			Local_u32CoreClkHz = (uint32_t)Local_u64Value;
+
+			for(Local_u8Rec = 0; Local_u8Rec < Local_u8IRQs; Local_u8Rec++)
+			{
+				DECODE_pu8GetRecord(Local_pu8Src + (Local_u8Rec * DECODE_RECORD_SIZE), &Local_Record);
+				Local_u64AllCycles += Local_Record.TotalCycles;
+			}
+
+			printf("core clk %lu Hz, %u IRQs, %u EXTI lines, %llu IRQ cycles\n\n", (unsigned long)Local_u32CoreClkHz,
+				   Local_u8IRQs, Local_u8Lines, (unsigned long long)Local_u64AllCycles);
+
+			Local_pu8Src = DECODE_pu8PrintRecords(Local_pu8Src, Local_u8IRQs, "IRQ", Local_u32CoreClkHz, Local_u64AllCycles);
+			printf("\n");
+			DECODE_pu8PrintRecords(Local_pu8Src, Local_u8Lines, "EXTI line", Local_u32CoreClkHz, Local_u64AllCycles);
+
+			Local_Ret = 0;
+		}
+	}
+
+	return Local_Ret;
+}